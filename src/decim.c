@@ -0,0 +1,61 @@
+#include <stdint.h>
+#include "decim.h"
+
+// integrators (raw rate) and comb delays (decimated rate), modulo 2^32
+static uint32_t integ1 = 0, integ2 = 0, integ3 = 0;
+static uint32_t comb1 = 0, comb2 = 0, comb3 = 0;
+
+// the last two CIC outputs, for the compensator
+static int32_t hist1 = 0, hist2 = 0;
+
+static int32_t ref = 0;
+static int have_ref = 0;
+
+
+/* Forgets the filter state */
+void decim_reset(void) {
+	integ1 = integ2 = integ3 = 0;
+	comb1 = comb2 = comb3 = 0;
+	hist1 = hist2 = 0;
+	have_ref = 0;
+}
+
+
+/* CIC + compensator over one block (see decim.h) */
+int decim_block(const int32_t* raw, int raw_len, int32_t* out) {
+	int i, k;
+	int count = raw_len / DECIM_R;
+
+	if (!have_ref && raw_len > 0) {
+		// seed with the bias: the state as if the input had been sitting there
+		ref = raw[0];
+		have_ref = 1;
+	}
+
+	for (i = 0; i < count; i++) {
+		const int32_t* x = raw + i * DECIM_R;
+
+		for (k = 0; k < DECIM_R; k++) {
+			integ1 += (uint32_t)((x[k] - ref) >> 2);
+			integ2 += integ1;
+			integ3 += integ2;
+		}
+
+		uint32_t c1 = integ3 - comb1;
+		comb1 = integ3;
+		uint32_t c2 = c1 - comb2;
+		comb2 = c1;
+		uint32_t c3 = c2 - comb3;
+		comb3 = c2;
+
+		// gain 64, quartered on the way in
+		int32_t y = (int32_t)c3 >> 4;
+
+		int32_t z = (6 * hist1 - y - hist2) >> 2;
+		hist2 = hist1;
+		hist1 = y;
+
+		out[i] = z + ref;
+	}
+	return count;
+}
@@ -0,0 +1,34 @@
+/*
+Anti-aliasing decimator by DECIM_R for the raw stream grabber samples, run on each block as it is read.
+Taking every 4th sample folds everything between the decimated Nyquist (~6.1 kHz) and 24 kHz into the
+tuning band. Here the samples go through a 3rd-order CIC filter (three running sums over 4 samples,
+integer adds only) whose nulls sit on the multiples of the decimated rate, exactly where the tuning
+band's aliases come from, followed by a 3-tap compensator at the decimated rate for the CIC's droop:
+	CIC:          H(z) = ((1 - z^-4) / (1 - z^-1))^3 / 64
+	compensator:  (-1 + 6 z^-1 - z^-2) / 4
+Aliases landing below 1.3 kHz are down 53 dB or more, those landing near 4.2 kHz (the top of the search
+range) 16 dB. The passband stays within 1 dB up to 4.2 kHz (the CIC alone is 5 dB down there).
+The integrators wrap in uint32 arithmetic, which the combs undo as long as the filtered output fits in
+32 bits; the input is taken relative to the first sample (the mic bias) and quartered to guarantee that
+(2 of the 26 bits; the full ADC swing then reaches 2^30).
+State carries over from block to block, so blocks that follow each other decimate as one stream;
+the caller resets it before a block that doesn't follow the last one (capture_frame in tuner.c does
+after every gap), otherwise the first 4 outputs mix in the samples from before the gap.
+
+	decim_reset - forgets the state; the next block re-seeds the reference
+	decim_block - filters raw_len raw samples (a multiple of DECIM_R) into raw_len / DECIM_R outputs, in
+	              raw sample units (reference added back, so the DC is still there for the caller to
+	              remove); returns the number of outputs
+*/
+
+#ifndef DECIM_H
+#define DECIM_H
+
+#include <stdint.h>
+
+#define DECIM_R 4
+
+void decim_reset(void);
+int decim_block(const int32_t* raw, int raw_len, int32_t* out);
+
+#endif
@@ -1,52 +1,217 @@
+#include <stdlib.h>
+#include <math.h>
 #include "fft.h"
 #include "complex.h"
-#include "trig.h"
-
-#define MAX_M 9
+#include "fft_tables.h"
+#include "fft_simd.h"
 
 #define F_MIN  80.0f    // E2 ~ 82.4 Hz
 #define F_MAX 4200.0f   // C7 ~ 4186 Hz
 
+#define TWO_PI 6.28318531f   // full precision, PI in fft.h is truncated
+
+// stage j twiddles exp(-j*PI*k/2^j), k < 2^j, stored back to back from index 2^j - 1
+#define TW_RE(p, j) ((p)->tw_re + (1 << (j)) - 1)
+#define TW_IM(p, j) ((p)->tw_im + (1 << (j)) - 1)
+
+// per-plan scratch length for an n-point plan
+#if FFT_KERNEL == FFT_KERNEL_LEGACY
+#define WORK_LEN(n) (n)             // reorder buffers
+#else
+#define WORK_LEN(n) ((n) / 2 + 1)   // Goertzel results only
+#endif
+
+
+struct fft_plan {
+	int n;
+	int m;
+
+	const float* tw_re;             // n - 1 twiddles (stages 0..m-1), const tables when n <= FFT_TABLE_N
+	const float* tw_im;
+
+	float* mag;                     // n/2 + 1 squared magnitudes from the peak search
+	float* work_re;                 // WORK_LEN(n) scratch
+	float* work_im;
+
+	// peak search range (Hz)
+	float range_lo_hz;
+	float range_hi_hz;
+
+	// output pruning for the real path (prune_count = 0 -> full transform)
+	int* prune_bins;                // listed output bins
+	int prune_count;
+	unsigned char* bin_needed;      // [k] = 1 if X[k] is listed, n/2 + 1
+	unsigned char* col_needed;      // stage j columns k at [(1 << j) - 1 + k], n/2
+	int prune_goertzel;             // 1 -> Goertzel bank instead of the FFT
+
+	int simd;                       // FFT_SIMD_* level the kernels may use
+	int interp;                     // FFT_INTERP_* peak interpolator
+	int peak_search;                // 0 -> transform only, execute calls report no peak
+
+	// optional |X[k]| output for k < spectrum_count, filled by the real path's last stage
+	float* spectrum;
+	int spectrum_count;
 
-static float new_[512];
-static float new_im[512];
+	// search range and bin spacing of the last peak search, mag[] is valid over it (fft_plan_get_peaks)
+	int last_start;
+	int last_end;
+	float last_bin_spacing;
+};
 
-// Precomputed twiddle factors: [stage][k]
-static float W_real_stage[MAX_M][256];
-static float W_imag_stage[MAX_M][256];
 
-// peak magnitue from last FFT call
+// peak search carried through the last stage of the real path (magnitudes fused into it)
+typedef struct {
+	int start;                      // search range (bins)
+	int end;
+	int place;                      // running argmax
+	float max;
+	float* spec;                    // |X[k]| for k < spec_count, may be NULL
+	int spec_count;
+	int pruned;                     // only the plan's listed bins of q/w are valid
+} fft_scan;
+
+
+// default plan behind fft()/fft_real(), static storage and the generated twiddles (n <= FFT_TABLE_N)
+static fft_plan default_plan;
+static float default_mag[FFT_TABLE_N / 2 + 1];
+static float default_work_re[WORK_LEN(FFT_TABLE_N)];
+static float default_work_im[WORK_LEN(FFT_TABLE_N)];
+static int default_prune_bins[FFT_TABLE_N / 2 + 1];
+static unsigned char default_bin_needed[FFT_TABLE_N / 2 + 1];
+static unsigned char default_col_needed[FFT_TABLE_N / 2];
+
+// peak magnitue from last fft()/fft_real() call
 static float last_peak_mag = 0.0f;
 
 
 
-/* pre-computation for fft */
+/* Returns m with 2^m == n, or -1 if n is not a power of two */
+static int fft_log2(int n) {
+	int m = 0;
+	if (n <= 0 || (n & (n - 1))) return -1;
+	while ((1 << m) < n) m++;
+	return m;
+}
+
+
+/* Sets the size-dependent defaults of a plan whose storage is already attached */
+static void fft_plan_reset(fft_plan* p, int n, int m) {
+	p->n = n;
+	p->m = m;
+	p->range_lo_hz = F_MIN;
+	p->range_hi_hz = F_MAX;
+	p->prune_count = 0;
+	p->prune_goertzel = 0;
+	p->spectrum = 0;
+	p->spectrum_count = 0;
+	p->last_start = 1;
+	p->last_end = 0;
+	p->last_bin_spacing = 0.0f;
+	p->interp = FFT_INTERP_PARABOLIC;
+	p->peak_search = 1;
+#if FFT_SIMD
+	p->simd = fft_simd_detect();
+#else
+	p->simd = FFT_SIMD_SCALAR;
+#endif
+}
+
+
+/* pre-computation for fft: sets up the default plan (twiddles are generated at build time).
+   n must be a power of two, FFT_PLAN_MIN_N <= n <= FFT_TABLE_N, with 2^m == n; any other size
+   leaves the default plan unset and fft()/fft_real() return 0 until a valid fft_init */
 void fft_init(int n, int m){
-	int j, k;
-	int b;
+	if (fft_log2(n) != m || n < FFT_PLAN_MIN_N || n > FFT_TABLE_N) {
+		default_plan.n = 0;
+		return;
+	}
+	default_plan.tw_re = fft_twiddle_re;
+	default_plan.tw_im = fft_twiddle_im;
+	default_plan.mag = default_mag;
+	default_plan.work_re = default_work_re;
+	default_plan.work_im = default_work_im;
+	default_plan.prune_bins = default_prune_bins;
+	default_plan.bin_needed = default_bin_needed;
+	default_plan.col_needed = default_col_needed;
+	fft_plan_reset(&default_plan, n, m);
+}
 
-	// Precompute twiddles for each stage j = 0..m-1
-	b = 1;
-	for (j = 0; j < m; j++) {
-		for (k = 0; k < b; k++) {
-			float angle = -PI * k / b;
-			W_real_stage[j][k] = cosine(angle);
-			W_imag_stage[j][k] = sine(angle);
+
+/* Getter */
+fft_plan* fft_default_plan(void) {
+	return &default_plan;
+}
+
+
+/* Creates a plan for an n-point transform, FFT_PLAN_MIN_N <= n <= FFT_PLAN_MAX_N */
+fft_plan* fft_plan_create(int n) {
+	int m = fft_log2(n);
+	int i, j, k;
+
+	if (m < 0 || n < FFT_PLAN_MIN_N || n > FFT_PLAN_MAX_N) return 0;
+
+	// one block: plan, floats (twiddles if needed, mag, work), ints, bytes
+	int own_tw = (n > FFT_TABLE_N);
+	size_t n_float = (own_tw ? 2 * (size_t)(n - 1) : 0) + (n / 2 + 1) + 2 * WORK_LEN(n);
+	size_t size = sizeof(fft_plan) + n_float * sizeof(float)
+	            + (n / 2 + 1) * sizeof(int) + (n / 2 + 1) + n / 2;
+
+	fft_plan* p = (fft_plan*)malloc(size);
+	if (!p) return 0;
+
+	float* f = (float*)(p + 1);
+	if (own_tw) {
+		float* tw_re = f;
+		float* tw_im = f + (n - 1);
+		for (j = 0; j < m; j++) {
+			int b = 1 << j;
+			for (k = 0; k < b; k++) {
+				double angle = -3.14159265358979323846 * k / b;
+				tw_re[b - 1 + k] = (float)cos(angle);
+				tw_im[b - 1 + k] = (float)sin(angle);
+			}
 		}
-		b *= 2;
+		p->tw_re = tw_re;
+		p->tw_im = tw_im;
+		f += 2 * (n - 1);
+	} else {
+		// generated tables cover every stage up to FFT_TABLE_M
+		p->tw_re = fft_twiddle_re;
+		p->tw_im = fft_twiddle_im;
 	}
+	p->mag = f;
+	f += n / 2 + 1;
+	p->work_re = f;
+	f += WORK_LEN(n);
+	p->work_im = f;
+	f += WORK_LEN(n);
+
+	p->prune_bins = (int*)f;
+	p->bin_needed = (unsigned char*)(p->prune_bins + n / 2 + 1);
+	p->col_needed = p->bin_needed + n / 2 + 1;
+	for (i = 0; i < n / 2; i++) p->col_needed[i] = 0;
+
+	fft_plan_reset(p, n, m);
+	return p;
 }
 
 
-/* FFT Algorithm */
-float fft(float* q, float* w, int n, int m, float sample_f) {
+/* Frees a plan from fft_plan_create */
+void fft_plan_destroy(fft_plan* p) {
+	if (p && p != &default_plan) free(p);
+}
+
+
+#if FFT_KERNEL == FFT_KERNEL_LEGACY
+/* Reorders q/w and runs the m butterfly stages (n-point complex transform, in place) */
+static void fft_core_frame(const fft_plan* p, float* q, float* w, int n, int m) {
+	float* new_ = p->work_re;
+	float* new_im = p->work_im;
 	int a,b,r,d,e,c;
-	int k,place;
+	int k;
 	a=n/2;
 	b=1;
 	int i,j;
-	float real=0,imagine=0;
-	float max,frequency;
 
 	// Ordering algorithm
 	for(i=0; i<(m-1); i++){
@@ -83,8 +248,8 @@ float fft(float* q, float* w, int n, int m, float sample_f) {
             int start = k * blockSize;
             int end = start + blockSize;
 
-            float Wr = W_real_stage[j][k];
-            float Wi = W_imag_stage[j][k];
+            float Wr = TW_RE(p, j)[k];
+            float Wi = TW_IM(p, j)[k];
 
             for (i = start; i < end; i += 2) {
 
@@ -123,55 +288,278 @@ float fft(float* q, float* w, int n, int m, float sample_f) {
 
         b *= 2;
     }
+}
+
+
+/* Runs the legacy kernel on each of the frames (n apart); it has no pruned path, so cols is not used */
+static void fft_core(const fft_plan* p, float* q, float* w, int n, int m, const unsigned char* cols, int frames) {
+	int f;
+	(void)cols;
+	for (f = 0; f < frames; f++) {
+		fft_core_frame(p, q + f * n, w + f * n, n, m);
+	}
+}
+
+#else
+
+/* Bit-reversal permutation of q/w in a single pass */
+static void fft_bitrev(float* q, float* w, int n) {
+	int i, j, bit;
+	float t;
+
+	j = 0;
+	for (i = 0; i < n - 1; i++) {
+		if (i < j) {
+			t = q[i]; q[i] = q[j]; q[j] = t;
+			t = w[i]; w[i] = w[j]; w[j] = t;
+		}
+		bit = n >> 1;
+		while (j & bit) {
+			j ^= bit;
+			bit >>= 1;
+		}
+		j |= bit;
+	}
+}
+
+
+#if FFT_KERNEL == FFT_KERNEL_RADIX4
+
+/* In-place radix-4 kernel: bit-reversal, a twiddle-free radix-2 stage when m is odd, then radix-4 passes.
+   cols (optional) marks the stage columns that feed a needed output, see fft_set_bins.
+   frames transforms of n points sit back to back in q/w; a column's butterflies never cross a
+   frame boundary, so each column walks all frames with its twiddles loaded once */
+static void fft_core(const fft_plan* p, float* q, float* w, int n, int m, const unsigned char* cols, int frames) {
+	int i, j, k;
+	int total = n * frames;
+
+	for (i = 0; i < frames; i++) {
+		fft_bitrev(q + i * n, w + i * n, n);
+	}
+
+	j = 0;
+	if (m & 1) {
+		// radix-2 cleanup stage (twiddle is 1)
+		for (i = 0; i < total; i += 2) {
+			float a = q[i + 1];
+			float b_im = w[i + 1];
+			q[i + 1] = q[i] - a;
+			w[i + 1] = w[i] - b_im;
+			q[i] = q[i] + a;
+			w[i] = w[i] + b_im;
+		}
+		j = 1;
+	}
+
+	// each pass does radix-2 stages j and j+1 at once
+	for (; j < m; j += 2) {
+		int h = 1 << j;
+		int span = h << 2;
+
+		// stage j+1 table holds exp(-j*PI*x/(2h)) for x < 2h
+		const float* Tr = TW_RE(p, j + 1);
+		const float* Ti = TW_IM(p, j + 1);
+
+#if FFT_SIMD
+		if (p->simd >= FFT_SIMD_AVX2 && h >= 8) {
+			fft_simd_r4_pass_avx2(q, w, total, h, Tr, Ti, TW_RE(p, j), TW_IM(p, j), cols ? cols + h - 1 : 0);
+			continue;
+		}
+		if (p->simd >= FFT_SIMD_SSE2 && h >= 4) {
+			fft_simd_r4_pass_sse2(q, w, total, h, Tr, Ti, TW_RE(p, j), TW_IM(p, j), cols ? cols + h - 1 : 0);
+			continue;
+		}
+#endif
+
+		for (k = 0; k < h; k++) {
+			// none of this column's four outputs reaches a needed bin
+			if (cols && !cols[h - 1 + k]) continue;
+
+			float W1r = Tr[k];
+			float W1i = Ti[k];
+			float W2r = TW_RE(p, j)[k];
+			float W2i = TW_IM(p, j)[k];
+			float W3r, W3i;
+
+			// W^3k wraps past the table: exp(-j*PI*(x+2h)/(2h)) = -exp(-j*PI*x/(2h))
+			if (3 * k < 2 * h) {
+				W3r = Tr[3 * k];
+				W3i = Ti[3 * k];
+			} else {
+				W3r = -Tr[3 * k - 2 * h];
+				W3i = -Ti[3 * k - 2 * h];
+			}
+
+			for (i = k; i < total; i += span) {
+				int i1 = i + h;
+				int i2 = i1 + h;
+				int i3 = i2 + h;
+
+				// three complex multiplies per four outputs
+				float br = q[i1] * W2r - w[i1] * W2i;
+				float bi = q[i1] * W2i + w[i1] * W2r;
+				float cr = q[i2] * W1r - w[i2] * W1i;
+				float ci = q[i2] * W1i + w[i2] * W1r;
+				float dr = q[i3] * W3r - w[i3] * W3i;
+				float di = q[i3] * W3i + w[i3] * W3r;
+
+				float s0r = q[i] + br;
+				float s0i = w[i] + bi;
+				float s1r = q[i] - br;
+				float s1i = w[i] - bi;
+				float s2r = cr + dr;
+				float s2i = ci + di;
+				float s3r = cr - dr;
+				float s3i = ci - di;
+
+				q[i]  = s0r + s2r;
+				w[i]  = s0i + s2i;
+				q[i2] = s0r - s2r;
+				w[i2] = s0i - s2i;
+				// s1 -/+ j*s3
+				q[i1] = s1r + s3i;
+				w[i1] = s1i - s3r;
+				q[i3] = s1r - s3i;
+				w[i3] = s1i + s3r;
+			}
+		}
+	}
+}
+
+#else
+
+/* In-place radix-2 kernel: one bit-reversal, then m butterfly stages with no copy-back.
+   cols (optional) marks the stage columns that feed a needed output, see fft_set_bins.
+   frames transforms of n points sit back to back in q/w, each column walks all of them */
+static void fft_core(const fft_plan* p, float* q, float* w, int n, int m, const unsigned char* cols, int frames) {
+	int i, j, k;
+	int total = n * frames;
+
+	for (i = 0; i < frames; i++) {
+		fft_bitrev(q + i * n, w + i * n, n);
+	}
+
+	for (j = 0; j < m; j++) {
+		int half = 1 << j;
+		int span = half << 1;
+
+#if FFT_SIMD
+		if (p->simd >= FFT_SIMD_AVX2 && half >= 8) {
+			fft_simd_r2_stage_avx2(q, w, total, half, TW_RE(p, j), TW_IM(p, j), cols ? cols + half - 1 : 0);
+			continue;
+		}
+		if (p->simd >= FFT_SIMD_SSE2 && half >= 4) {
+			fft_simd_r2_stage_sse2(q, w, total, half, TW_RE(p, j), TW_IM(p, j), cols ? cols + half - 1 : 0);
+			continue;
+		}
+#endif
+
+		for (k = 0; k < half; k++) {
+			if (cols && !cols[half - 1 + k]) continue;
+
+			// same twiddle for every butterfly in this column
+			float Wr = TW_RE(p, j)[k];
+			float Wi = TW_IM(p, j)[k];
+
+			for (i = k; i < total; i += span) {
+				int i1 = i + half;
+
+				// (a + j*b_im) * (Wr + j*Wi)
+				float a = q[i1];
+				float b_im = w[i1];
+				float real = a * Wr - b_im * Wi;
+				float imagine = a * Wi + b_im * Wr;
+
+				q[i1] = q[i] - real;
+				w[i1] = w[i] - imagine;
+				q[i] = q[i] + real;
+				w[i] = w[i] + imagine;
+			}
+		}
+	}
+}
+
+#endif /* FFT_KERNEL == FFT_KERNEL_RADIX4 */
 
+#endif
+
+
+static void scan_bin(fft_plan* p, fft_scan* sc, int k, float re, float im);
+
+/* Goertzel bank over the listed bins of the real input q (n samples), magnitudes into sc */
+static void fft_goertzel(fft_plan* p, float* q, float* w, int n, int m, fft_scan* sc) {
+	int i, b;
+	int half = n / 2;
+
+	for (b = 0; b < p->prune_count; b++) {
+		int k = p->prune_bins[b];
+
+		// cos/sin of 2*PI*k/n straight from the last stage's twiddles
+		float c = (k < half) ? TW_RE(p, m - 1)[k] : -1.0f;
+		float sn = (k < half) ? -TW_IM(p, m - 1)[k] : 0.0f;
+		float coeff = 2.0f * c;
+		float s1 = 0.0f;
+		float s2 = 0.0f;
+
+		for (i = 0; i < n; i++) {
+			float s0 = q[i] + coeff * s1 - s2;
+			s2 = s1;
+			s1 = s0;
+		}
+
+		// X[k] = s1*cos - s2 + j*s1*sin (same phase as the FFT bin)
+		p->work_re[b] = c * s1 - s2;
+		p->work_im[b] = sn * s1;
+	}
+
+	for (b = 0; b < p->prune_count; b++) {
+		int k = p->prune_bins[b];
+		q[k] = p->work_re[b];
+		w[k] = p->work_im[b];
+		scan_bin(p, sc, k, q[k], w[k]);
+	}
+}
+
+
+/* Starts a peak search over the plan's range (bins) */
+static void fft_scan_init(const fft_plan* p, fft_scan* sc, int n, float sample_f) {
     // bin spacing in Hz for this FFT call
     float bin_spacing = sample_f / (float)n;
 
     // convert desired freq range to bin indices
-    int start_bin = (int)(F_MIN / bin_spacing + 0.5f);
-    int end_bin = (int)(F_MAX / bin_spacing + 0.5f);
+    sc->start = (int)(p->range_lo_hz / bin_spacing + 0.5f);
+    sc->end = (int)(p->range_hi_hz / bin_spacing + 0.5f);
 
-    if (start_bin < 1) start_bin = 1;        // skip DC
-    if (end_bin > (n/2 - 1)) end_bin   = (n/2 - 1);
+    if (sc->start < 1) sc->start = 1;        // skip DC
+    if (sc->end > (n/2 - 1)) sc->end = (n/2 - 1);
+    if (!p->peak_search) sc->end = sc->start - 1;    // empty range: no bin can become the peak
 
-    max = 0.0f;
-    place = start_bin;
-
-    // Peak magnitude
-    for (i = start_bin; i <= end_bin; ++i) {
-        float re = q[i];
-        float im = w[i];
-        float mag2 = re*re + im*im;
-        new_[i] = mag2;    
+    sc->max = 0.0f;
+    sc->place = sc->start;
+    sc->spec = p->spectrum;
+    sc->spec_count = p->spectrum_count;
+    sc->pruned = 0;
+}
 
-        if (mag2 > max) {
-            max = mag2;
-            place = i;
-        }
-    }
 
-    // store peak magnitude
-    last_peak_mag = max;
+/* Squared magnitude of bin k into the peak search and |X[k]| into the spectrum buffer, any bin order */
+static void scan_bin(fft_plan* p, fft_scan* sc, int k, float re, float im) {
+    float mag2 = re*re + im*im;
+    p->mag[k] = mag2;
 
-    // if no significant energy, exit
-    if (max <= 0.0f) {
-        return 0.0f;
+    // in range, and the lowest bin wins a tie (same result as a sweep from start up)
+    if (mag2 >= sc->max && k >= sc->start && k <= sc->end && (mag2 > sc->max || k < sc->place)) {
+        sc->max = mag2;
+        sc->place = k;
     }
-
-    // bin spacing in Hz
-    bin_spacing = sample_f / (float)n;
-
-    // make sure we have neighbors
-    if (place <= start_bin || place >= end_bin) {
-        // use bin center if no neighbor
-        return bin_spacing * (float)place;
+    if (k < sc->spec_count) {
+        sc->spec[k] = sqrtf(mag2);
     }
+}
 
-    // 3-point parabolic interpolation around the peak
-    float y1 = new_[place - 1];
-    float y2 = new_[place];
-    float y3 = new_[place + 1];
 
+/* Fractional offset of the vertex of the parabola through y1, y2, y3, clamped to [-1, 1] */
+static float parabolic_offset(float y1, float y2, float y3) {
     float denom = (y1 - 2.0f * y2 + y3);
     float delta = 0.0f;  // fractional bin offset
 
@@ -182,17 +570,730 @@ float fft(float* q, float* w, int n, int m, float sample_f) {
         if (delta < -1.0f) delta = -1.0f;
         if (delta >  1.0f) delta =  1.0f;
     }
+    return delta;
+}
+
+
+/* Hann main lobe: a neighbor at alpha times the peak's magnitude puts the tone (2*alpha - 1) / (alpha + 1)
+   bins from the peak towards that neighbor */
+static float hann_ratio_offset(float alpha) {
+    if (alpha < 0.0f) alpha = 0.0f;
+    if (alpha > 1.0f) alpha = 1.0f;
+    return (2.0f * alpha - 1.0f) / (alpha + 1.0f);
+}
+
+
+/* Peak offset from the squared magnitudes around it (parabolic, Gaussian or Jain; Quinn falls back to Jain).
+   n is the frame length, for the symmetric window's correction */
+static float mag_offset(int interp, float y1, float y2, float y3, int n) {
+    float d;
+
+    switch (interp) {
+        case FFT_INTERP_GAUSSIAN:
+            // parabola through the log magnitudes, exact for a Gaussian lobe
+            if (y1 > 0.0f && y3 > 0.0f) {
+                return parabolic_offset(logf(y1), logf(y2), logf(y3));
+            }
+            break;
+        case FFT_INTERP_JAIN:
+        case FFT_INTERP_QUINN:
+            // ratio to the larger neighbor; a symmetric window's lobe is wider by a factor n / (n - 1),
+            // which pulls the estimate towards that neighbor by (1 - 2|d|) / n
+            d = hann_ratio_offset(sqrtf(((y3 >= y1) ? y3 : y1) / y2));
+            d -= (1.0f - 2.0f * fabsf(d)) / (float)n;
+            return (y3 >= y1) ? d : -d;
+        default:
+            break;
+    }
+    return parabolic_offset(y1, y2, y3);
+}
+
+
+/* Public mag_offset, for magnitudes read from a spectrum buffer */
+float fft_interp_offset(int interp, float y1, float y2, float y3, int n) {
+    if (y2 <= 0.0f) return 0.0f;
+    return mag_offset(interp, y1, y2, y3, n);
+}
+
+
+/* Quinn-style offset from the complex bins around the peak, Hann form. Each neighbor's ratio to the peak,
+   rotated by the half-bin phase step of a symmetric window, is real for a pure tone; its real part gives one
+   estimate per side, and the two are averaged with the neighbors' energies as weights */
+static float quinn_offset(const float* q, const float* w, int place, int n) {
+    float pr = q[place];
+    float pi = w[place];
+    float p2 = pr * pr + pi * pi;
+    if (p2 <= 0.0f) return 0.0f;
+
+    // exp(-j*PI/n): bin-to-bin phase of a symmetric n-point window, on top of the lobe's sign change
+    float c = cosf(TWO_PI * 0.5f / (float)n);
+    float s = sinf(TWO_PI * 0.5f / (float)n);
+
+    // Re(X[k+1] * conj(X[k]) * exp(-j*PI/n)) and Re(X[k-1] * conj(X[k]) * exp(+j*PI/n))
+    float ur = q[place + 1] * pr + w[place + 1] * pi;
+    float ui = w[place + 1] * pr - q[place + 1] * pi;
+    float vr = q[place - 1] * pr + w[place - 1] * pi;
+    float vi = w[place - 1] * pr - q[place - 1] * pi;
+    float a_hi = -(ur * c + ui * s) / p2;
+    float a_lo = -(vr * c - vi * s) / p2;
+
+    float d_hi = hann_ratio_offset(a_hi);
+    float d_lo = -hann_ratio_offset(a_lo);
+    float w_hi = q[place + 1] * q[place + 1] + w[place + 1] * w[place + 1];
+    float w_lo = q[place - 1] * q[place - 1] + w[place - 1] * w[place - 1];
+
+    if (w_hi + w_lo <= 0.0f) return 0.0f;
+    return (w_hi * d_hi + w_lo * d_lo) / (w_hi + w_lo);
+}
+
+
+/* Reports the peak found by a search and refines it with the plan's interpolator; q/w hold the frame's bins */
+static float fft_peak_finish(fft_plan* p, const fft_scan* sc, const float* q, const float* w, int n,
+                             float sample_f, fft_result* out) {
+    float frequency;
+    float* mag = p->mag;
+    int place = sc->place;
+    float max = sc->max;
+    float bin_spacing = sample_f / (float)n;
+
+    p->last_start = sc->start;
+    p->last_end = sc->end;
+    p->last_bin_spacing = bin_spacing;
+
+    // report peak magnitude and bin
+    if (out) {
+        out->peak_mag = max;
+        out->peak_bin = place;
+        out->frequency = 0.0f;
+    }
+
+    // if no significant energy, exit
+    if (max <= 0.0f) {
+        return 0.0f;
+    }
+
+    // make sure we have neighbors; at the edge of the search range they may still
+    // lie outside it (e.g. a low E just above the range's first bin)
+    if (place <= 1 || place >= n / 2 - 1 ||
+        (sc->pruned && (!p->bin_needed[place - 1] || !p->bin_needed[place + 1]))) {
+        // use bin center if no neighbor
+        frequency = bin_spacing * (float)place;
+        if (out) out->frequency = frequency;
+        return frequency;
+    }
+
+    // fractional offset from the 3 bins around the peak
+    float delta;
+    if (p->interp == FFT_INTERP_QUINN) {
+        delta = quinn_offset(q, w, place, n);
+    } else if (place > sc->start && place < sc->end) {
+        delta = mag_offset(p->interp, mag[place - 1], mag[place], mag[place + 1], n);
+    } else {
+        float lo = q[place - 1] * q[place - 1] + w[place - 1] * w[place - 1];
+        float hi = q[place + 1] * q[place + 1] + w[place + 1] * w[place + 1];
+        delta = mag_offset(p->interp, lo, max, hi, n);
+    }
 
     // final frequency estimate (bin index + fractional offset)
     frequency = ( (float)place + delta ) * bin_spacing;
 
+    if (out) out->frequency = frequency;
     return frequency;
 }
 
 
+/* Peak search over the plan's range, then interpolation (separate sweep, complex path) */
+static float fft_peak(fft_plan* p, float* q, float* w, int n, float sample_f, fft_result* out) {
+    int i;
+    float* mag = p->mag;
+    fft_scan sc;
+
+    fft_scan_init(p, &sc, n, sample_f);
+    if (!p->peak_search) return fft_peak_finish(p, &sc, q, w, n, sample_f, out);
+
+    // Peak magnitude
+#if FFT_SIMD
+    if (p->simd >= FFT_SIMD_AVX2) {
+        sc.place = fft_simd_magmax_avx2(q, w, mag, sc.start, sc.end, &sc.max);
+    } else if (p->simd >= FFT_SIMD_SSE2) {
+        sc.place = fft_simd_magmax_sse2(q, w, mag, sc.start, sc.end, &sc.max);
+    } else
+#endif
+    for (i = sc.start; i <= sc.end; ++i) {
+        float re = q[i];
+        float im = w[i];
+        float mag2 = re*re + im*im;
+        mag[i] = mag2;
+
+        if (mag2 > sc.max) {
+            sc.max = mag2;
+            sc.place = i;
+        }
+    }
+
+    return fft_peak_finish(p, &sc, q, w, n, sample_f, out);
+}
+
+
+/* Complex FFT of q/w with the plan's size, then peak search */
+float fft_execute(fft_plan* p, float* q, float* w, float sample_f, fft_result* out) {
+	fft_core(p, q, w, p->n, p->m, 0, 1);
+	return fft_peak(p, q, w, p->n, sample_f, out);
+}
+
+
+/* Splits the n/2-point result zr/zi into bins 0..n/2 of the real input, written to q/w, and feeds
+   each bin to the peak search as it is produced. zr/zi may be q/w themselves or a region that
+   doesn't overlap them */
+static void fft_split(fft_plan* p, const float* zr, const float* zi, float* q, float* w, int pruned, fft_scan* sc) {
+	int n = p->n;
+	int half = n / 2;
+	int k;
+
+	// peak search state in locals: the mag stores could otherwise alias it
+	float* mag = p->mag;
+	int start = sc->start;
+	int end = sc->end;
+	int place = sc->place;
+	float max = sc->max;
+
+	// split Z[k] back into the spectrum of the real input: X[k] = Fe[k] + W^k * Fo[k]
+	float z0r = zr[0];
+	float z0i = zi[0];
+	q[0] = z0r + z0i;
+	w[0] = 0.0f;
+	q[half] = z0r - z0i;
+	w[half] = 0.0f;
+	scan_bin(p, sc, 0, q[0], 0.0f);
+	scan_bin(p, sc, half, q[half], 0.0f);
+
+	// W^k = exp(-j*2*PI*k/n) is the last stage's twiddle table
+	const float* Tr = TW_RE(p, p->m - 1);
+	const float* Ti = TW_IM(p, p->m - 1);
+
+	for (k = 1; k <= half / 2; k++) {
+		if (pruned && !p->bin_needed[k] && !p->bin_needed[half - k]) continue;
+
+		float ar = zr[k];
+		float ai = zi[k];
+		float br = zr[half - k];
+		float bi = zi[half - k];
+
+		// even / odd sub-spectra
+		float fe_re = 0.5f * (ar + br);
+		float fe_im = 0.5f * (ai - bi);
+		float fo_re = 0.5f * (ai + bi);
+		float fo_im = 0.5f * (br - ar);
+
+		float Wr = Tr[k];
+		float Wi = Ti[k];
+		float tr = fo_re * Wr - fo_im * Wi;
+		float ti = fo_re * Wi + fo_im * Wr;
+
+		float xr = fe_re + tr;
+		float xi = fe_im + ti;
+		float yr = fe_re - tr;
+		float yi = ti - fe_im;
+
+		q[k] = xr;
+		w[k] = xi;
+		q[half - k] = yr;
+		w[half - k] = yi;
+
+		// squared magnitudes + running argmax; k climbs and half - k falls,
+		// so the lower bin has to win a tie explicitly to match a forward sweep
+		float mk = xr * xr + xi * xi;
+		float mh = yr * yr + yi * yi;
+		mag[k] = mk;
+		mag[half - k] = mh;
+
+		if (k >= start && k <= end && (mk > max || (mk == max && k < place))) {
+			max = mk;
+			place = k;
+		}
+		if (half - k >= start && half - k <= end && (mh > max || (mh == max && half - k < place))) {
+			max = mh;
+			place = half - k;
+		}
+
+		if (k < sc->spec_count) {
+			sc->spec[k] = sqrtf(mk);
+		}
+		if (half - k < sc->spec_count) {
+			sc->spec[half - k] = sqrtf(mh);
+		}
+	}
+
+	if (max > sc->max || (max == sc->max && place < sc->place)) {
+		sc->max = max;
+		sc->place = place;
+	}
+}
+
+
+/* Real-input FFT of frames back-to-back n-sample frames (frame f at q + f*n), one peak search per frame */
+void fft_execute_real_batch(fft_plan* p, float* q, float* w, int frames, float sample_f, fft_result* out) {
+	int n = p->n;
+	int m = p->m;
+	int half = n / 2;
+	int pruned = (p->prune_count > 0);
+	int f, i;
+	fft_scan sc;
+
+	if (pruned && p->prune_goertzel) {
+		for (f = 0; f < frames; f++) {
+			fft_scan_init(p, &sc, n, sample_f);
+			if (sc.spec) sc.spec += f * sc.spec_count;
+			sc.pruned = 1;
+			fft_goertzel(p, q + f * n, w + f * n, n, m, &sc);
+			fft_peak_finish(p, &sc, q + f * n, w + f * n, n, sample_f, out ? &out[f] : 0);
+		}
+		return;
+	}
+
+	// pack even samples as real part, odd samples as imaginary part; frame f's
+	// n/2 complex points go to f*n/2 so the core sees one contiguous batch
+	for (f = 0; f < frames; f++) {
+		const float* x = q + f * n;
+		float* zr = q + f * half;
+		float* zi = w + f * half;
+		for (i = 0; i < half; i++) {
+			zi[i] = x[2 * i + 1];
+			zr[i] = x[2 * i];
+		}
+	}
+
+	fft_core(p, q, w, half, m - 1, pruned ? p->col_needed : 0, frames);
+
+	// last frame first, so no frame's spectrum lands on a packed frame not yet split
+	for (f = frames - 1; f >= 0; f--) {
+		fft_scan_init(p, &sc, n, sample_f);
+		if (sc.spec) sc.spec += f * sc.spec_count;
+		sc.pruned = pruned;
+		fft_split(p, q + f * half, w + f * half, q + f * n, w + f * n, pruned, &sc);
+		fft_peak_finish(p, &sc, q + f * n, w + f * n, n, sample_f, out ? &out[f] : 0);
+	}
+}
+
+
+/* Real-input FFT: n real samples run as one n/2-point complex transform */
+float fft_execute_real(fft_plan* p, float* q, float* w, float sample_f, fft_result* out) {
+	fft_result res;
+	fft_execute_real_batch(p, q, w, 1, sample_f, &res);
+	if (out) *out = res;
+	return res.frequency;
+}
+
+
+/* Single-tone fit at omega (rad/sample): energy of the window-weighted least-squares projection of
+   x onto cos/sin, i.e. r' G^-1 r with r = sum h*x*[cos, sin] and G = sum h^2*[cos, sin][cos, sin]'.
+   A constant is fitted alongside and projected out first, so the DC the frame builder could not
+   remove (the average of a partial period) doesn't pull a tone sitting 1-2 bins above it */
+static float zoom_fit(const float* x, const float* h, int n, float omega) {
+	int i;
+	float cr = cosf(omega);
+	float ci = sinf(omega);
+	float pr = 1.0f, pi = 0.0f;                 // phasor exp(j*omega*i)
+	float rc = 0.0f, rs = 0.0f, r1 = 0.0f;      // correlation with cos / sin / 1
+	float e = 0.0f, c2 = 0.0f, s2 = 0.0f;       // sum h^2, sum h^2 cos(2wi), sum h^2 sin(2wi)
+	float gc = 0.0f, gs = 0.0f;                 // sum h^2 cos(wi), sum h^2 sin(wi)
+
+	for (i = 0; i < n; i++) {
+		float hi = h ? h[i] : 1.0f;
+		float xh = x[i] * hi;
+		float hh = hi * hi;
+
+		rc += xh * pr;
+		rs += xh * pi;
+		r1 += xh;
+		e += hh;
+		gc += hh * pr;
+		gs += hh * pi;
+		c2 += hh * (pr * pr - pi * pi);
+		s2 += hh * 2.0f * pr * pi;
+
+		float t = pr * cr - pi * ci;
+		pi = pr * ci + pi * cr;
+		pr = t;
+
+		// pull the phasor back to unit length now and then (first order)
+		if ((i & 63) == 63) {
+			float g = 1.5f - 0.5f * (pr * pr + pi * pi);
+			pr *= g;
+			pi *= g;
+		}
+	}
+	if (e <= 0.0f) return 0.0f;
+
+	// Schur complement of the constant: G - g g' / e, r - g r1 / e
+	float gcc = 0.5f * (e + c2) - gc * gc / e;
+	float gss = 0.5f * (e - c2) - gs * gs / e;
+	float gcs = 0.5f * s2 - gc * gs / e;
+	float det = gcc * gss - gcs * gcs;
+	if (det <= 0.0f) return 0.0f;
+
+	rc -= gc * r1 / e;
+	rs -= gs * r1 / e;
+	return (rc * rc * gss - 2.0f * rc * rs * gcs + rs * rs * gcc) / det;
+}
+
+
+/* Zoom-DFT: single-tone fit at points frequencies spread over f_center +/- span_hz/2 of the
+   time-domain frame x, then 3-point parabolic interpolation on that fine grid */
+float fft_zoom(const float* x, const float* window, int n, float sample_f, float f_center, float span_hz, int points) {
+	float fit[FFT_ZOOM_MAX_POINTS];
+	int k, place;
+
+	if (points < 3) points = 3;
+	if (points > FFT_ZOOM_MAX_POINTS) points = FFT_ZOOM_MAX_POINTS;
+
+	float step = span_hz / (float)(points - 1);
+	float f0 = f_center - 0.5f * span_hz;
+	if (f0 < step) f0 = step;               // stay clear of DC
+
+	place = 0;
+	for (k = 0; k < points; k++) {
+		fit[k] = zoom_fit(x, window, n, TWO_PI * (f0 + step * (float)k) / sample_f);
+		if (fit[k] > fit[place]) place = k;
+	}
+
+	if (place == 0 || place == points - 1) {
+		return f0 + step * (float)place;
+	}
+
+	float delta = parabolic_offset(fit[place - 1], fit[place], fit[place + 1]);
+
+	return f0 + step * ((float)place + delta);
+}
+
+
+/* Moves the smaller of heap[i]'s children up until heap[i] is the smallest of the three (min-heap on mag) */
+static void peak_sift_down(fft_peak_info* heap, int count, int i) {
+	for (;;) {
+		int c = 2 * i + 1;
+		if (c >= count) break;
+		if (c + 1 < count && heap[c + 1].mag < heap[c].mag) c++;
+		if (heap[i].mag <= heap[c].mag) break;
+
+		fft_peak_info t = heap[i];
+		heap[i] = heap[c];
+		heap[c] = t;
+		i = c;
+	}
+}
+
+
+/* The k strongest local maxima of the last transform's search range, strongest first.
+   One pass over the squared magnitudes, the k best kept in a min-heap */
+int fft_plan_get_peaks(const fft_plan* p, fft_peak_info* peaks, int k) {
+	int i, count = 0;
+	const float* mag = p->mag;
+	int start = p->last_start;
+	int end = p->last_end;
+
+	if (k > FFT_MAX_PEAKS) k = FFT_MAX_PEAKS;
+	if (k <= 0) return 0;
+
+	for (i = start; i <= end; i++) {
+		float y = mag[i];
+
+		// local maximum inside the range; plateaus count once, at their first bin
+		if (y <= 0.0f) continue;
+		if (i > start && y <= mag[i - 1]) continue;
+		if (i < end && y < mag[i + 1]) continue;
+		if (count == k && y <= peaks[0].mag) continue;
+
+		fft_peak_info pk;
+		pk.bin = i;
+		pk.mag = y;
+		float delta = (i > start && i < end) ? mag_offset(p->interp, mag[i - 1], y, mag[i + 1], p->n) : 0.0f;
+		pk.frequency = ((float)i + delta) * p->last_bin_spacing;
+
+		if (count < k) {
+			// append and sift up
+			int c = count++;
+			peaks[c] = pk;
+			while (c > 0 && peaks[(c - 1) / 2].mag > peaks[c].mag) {
+				fft_peak_info t = peaks[c];
+				peaks[c] = peaks[(c - 1) / 2];
+				peaks[(c - 1) / 2] = t;
+				c = (c - 1) / 2;
+			}
+		} else {
+			// replace the weakest kept peak
+			peaks[0] = pk;
+			peak_sift_down(peaks, count, 0);
+		}
+	}
+
+	// heap sort in place: weakest to the back, leaves the array strongest first
+	for (i = count - 1; i > 0; i--) {
+		fft_peak_info t = peaks[0];
+		peaks[0] = peaks[i];
+		peaks[i] = t;
+		peak_sift_down(peaks, i, 0);
+	}
+
+	return count;
+}
+
+
+/* |X| at fractional bin b: the larger of the two bins around it, 0 outside the last search range */
+static float hsum_mag(const fft_plan* p, float b) {
+	int k = (int)b;
+	if (k < p->last_start || k + 1 > p->last_end) return 0.0f;
+	float y = (p->mag[k] > p->mag[k + 1]) ? p->mag[k] : p->mag[k + 1];
+	return sqrtf(y);
+}
+
+
+/* Octave / subharmonic correction of a peak frequency from the last search's squared magnitudes.
+   For each divisor d the spectrum is sampled at the harmonics of frequency/d (a decimated copy of it,
+   read only where needed) up to the same ceiling as frequency's own harmonics; the positions that are
+   not harmonics of frequency have to average at least FFT_HSUM_RATIO of frequency's harmonics, and
+   of the divisors that pass, the one with the strongest in-between harmonics wins */
+float fft_plan_harmonic_fix(const fft_plan* p, float frequency, int* divisor) {
+	int pass, d, h;
+	int total = 1;
+	float spacing = p->last_bin_spacing;
+
+	if (divisor) *divisor = 1;
+	if (frequency <= 0.0f || spacing <= 0.0f) return frequency;
+
+	int peak_bin = (int)(frequency / spacing + 0.5f);
+	if (peak_bin < p->last_start || peak_bin > p->last_end) return frequency;
+	float floor_mag = sqrtf(FFT_HSUM_FLOOR * p->mag[peak_bin]);
+
+	for (pass = 0; pass < FFT_HSUM_MAX_PASSES; pass++) {
+		float b0 = frequency / spacing;
+		float top = b0 * (float)FFT_HSUM_HARMONICS;
+		if (top > (float)p->last_end) top = (float)p->last_end;
+
+		// mean magnitude over the current estimate's harmonics
+		float on = 0.0f;
+		int on_count = 0;
+		for (h = 1; (float)h * b0 <= top; h++) {
+			on += hsum_mag(p, (float)h * b0);
+			on_count++;
+		}
+		if (on <= 0.0f) break;
+		on /= (float)on_count;
+
+		// subharmonic with its own fundamental and the strongest in-between harmonics
+		int best = 1;
+		float best_score = FFT_HSUM_RATIO;
+		for (d = 2; d <= FFT_HSUM_MAX_DIV; d++) {
+			float c = b0 / (float)d;
+			if (c < (float)p->last_start) continue;
+			if (hsum_mag(p, c) < floor_mag) continue;
+
+			float between = 0.0f;
+			int count = 0;
+			for (h = 1; (float)h * c <= top; h++) {
+				if (h % d) {
+					between += hsum_mag(p, (float)h * c);
+					count++;
+				}
+			}
+			float score = between / ((float)count * on);
+			if (score >= best_score) {
+				best_score = score;
+				best = d;
+			}
+		}
+		if (best == 1) break;
+
+		frequency /= (float)best;
+		total *= best;
+	}
+
+	if (divisor) *divisor = total;
+	return frequency;
+}
+
+
+/* Sets the buffer the real path fills with |X[k]|, k < count (count <= n/2 + 1, NULL / 0 for none) */
+void fft_plan_set_spectrum(fft_plan* p, float* mag, int count) {
+	if (count > p->n / 2 + 1) count = p->n / 2 + 1;
+	p->spectrum = mag;
+	p->spectrum_count = mag ? count : 0;
+}
+
+
+/* Selects the interpolator that refines the peak bin (FFT_INTERP_*) */
+void fft_plan_set_interp(fft_plan* p, int interp) {
+	if (interp < FFT_INTERP_PARABOLIC || interp > FFT_INTERP_QUINN) interp = FFT_INTERP_PARABOLIC;
+	p->interp = interp;
+}
+
+
+/* Turns the plan's peak search on (the default) or off; off, the execute calls only transform */
+void fft_plan_set_peak_search(fft_plan* p, int on) {
+	p->peak_search = on ? 1 : 0;
+}
+
+
+/* Caps the SIMD level of the plan's kernels, returns the level in use */
+int fft_plan_set_simd(fft_plan* p, int level) {
+#if FFT_SIMD
+	int best = fft_simd_detect();
+	p->simd = (level < best) ? level : best;
+#else
+	(void)level;
+	p->simd = FFT_SIMD_SCALAR;
+#endif
+	return p->simd;
+}
+
+
+/* Sets the frequency range the plan's peak search looks at */
+void fft_plan_set_range(fft_plan* p, float f_min, float f_max) {
+	p->range_lo_hz = f_min;
+	p->range_hi_hz = f_max;
+}
+
+
+/* Marks every core butterfly column that feeds core output k */
+static void prune_mark(fft_plan* p, int k, int m) {
+	int j;
+	for (j = 0; j < m; j++) {
+		int half = 1 << j;
+		p->col_needed[half - 1 + (k & (half - 1))] = 1;
+	}
+}
+
+
+/* Restricts fft_execute_real to the listed output bins 0..n/2 (count = 0 turns pruning off) */
+void fft_plan_set_bins(fft_plan* p, const int* bins, int count) {
+	int i, j, k;
+	int n = p->n;
+	int m = p->m;
+	int half = n / 2;
+	long kept = 0;
+
+	p->prune_count = 0;
+	p->prune_goertzel = 0;
+	for (i = 0; i <= half; i++) p->bin_needed[i] = 0;
+	for (i = 0; i < half; i++) p->col_needed[i] = 0;
+
+	for (i = 0; i < count; i++) {
+		k = bins[i];
+		if (k < 0 || k > half || p->bin_needed[k]) continue;
+		p->bin_needed[k] = 1;
+		p->prune_bins[p->prune_count++] = k;
+
+		// the split reads Z[k] and Z[half - k] of the n/2-point core
+		prune_mark(p, k % half, m - 1);
+		prune_mark(p, (half - k) % half, m - 1);
+	}
+
+	if (p->prune_count == 0) return;
+
+	// butterflies left in the pruned core (radix-2 count); the legacy kernel runs all of them
+	for (j = 0; j < m - 1; j++) {
+		int cols = 1 << j;
+		for (k = 0; k < cols; k++) {
+			if (FFT_KERNEL == FFT_KERNEL_LEGACY || p->col_needed[cols - 1 + k]) kept += half / (2 * cols);
+		}
+	}
+
+	// rough cost: a butterfly ~10 flops, a Goertzel step 3 flops but one long
+	// dependency chain, so count it double
+	p->prune_goertzel = ((long)p->prune_count * n * 6 < kept * 10);
+}
+
+
+/* Default plan for the fft()/fft_real() calls, or 0 if fft_init wasn't called with this n and m */
+static fft_plan* fft_default_for(int n, int m) {
+	if (default_plan.n == 0 || default_plan.n != n || default_plan.m != m) return 0;
+	return &default_plan;
+}
+
+
+/* FFT Algorithm */
+float fft(float* q, float* w, int n, int m, float sample_f) {
+	fft_plan* p = fft_default_for(n, m);
+	fft_result res;
+	if (!p) {
+		last_peak_mag = 0.0f;
+		return 0.0f;
+	}
+	float frequency = fft_execute(p, q, w, sample_f, &res);
+	last_peak_mag = res.peak_mag;
+	return frequency;
+}
+
+
+/* Real-input FFT on the default plan */
+float fft_real(float* q, float* w, int n, int m, float sample_f) {
+	fft_plan* p = fft_default_for(n, m);
+	fft_result res;
+	if (!p) {
+		last_peak_mag = 0.0f;
+		return 0.0f;
+	}
+	float frequency = fft_execute_real(p, q, w, sample_f, &res);
+	last_peak_mag = res.peak_mag;
+	return frequency;
+}
+
+
+/* Sets the frequency range the peak search looks at (default plan) */
+void fft_set_range(float f_min, float f_max) {
+	fft_plan_set_range(&default_plan, f_min, f_max);
+}
+
+
+/* Restricts fft_real to the listed output bins (default plan) */
+void fft_set_bins(const int* bins, int count, int n, int m) {
+	fft_plan* p = fft_default_for(n, m);
+	if (p) fft_plan_set_bins(p, bins, count);
+}
+
+
+/* Top-k peaks of the last fft()/fft_real() call */
+int fft_get_peaks(fft_peak_info* peaks, int k) {
+	return fft_plan_get_peaks(&default_plan, peaks, k);
+}
+
+
+/* Octave correction against the last fft()/fft_real() call */
+float fft_harmonic_fix(float frequency, int* divisor) {
+	return fft_plan_harmonic_fix(&default_plan, frequency, divisor);
+}
+
+
 /* Getter */
 float fft_get_last_peak_mag(void){
 	return last_peak_mag;
 }
 
 
+/* DC removal, decimation, scale and window: q[i] = (raw[i*decim] - dc) * scale * window[i] */
+void fft_build_frame(const int32_t* raw, int raw_len, int decim, int n, float scale, const float* window, float* q) {
+	int i;
+
+#if FFT_SIMD
+	int level = fft_simd_detect();
+	if (level >= FFT_SIMD_AVX2) {
+		fft_simd_frame_avx2(raw, raw_len, decim, n, scale, window, q);
+		return;
+	}
+	if (level >= FFT_SIMD_SSE2) {
+		fft_simd_frame_sse2(raw, raw_len, decim, n, scale, window, q);
+		return;
+	}
+#endif
+
+	int64_t sum = 0;
+	for (i = 0; i < raw_len; i++) {
+		sum += raw[i];
+	}
+	int32_t dc = (int32_t)(sum / raw_len);   // avg sample
+
+	for (i = 0; i < n; i++) {
+		int idx = i * decim;
+		q[i] = (idx < raw_len) ? (float)(raw[idx] - dc) * scale : 0.0f;
+		if (window) q[i] *= window[i];
+	}
+}
@@ -20,16 +20,145 @@ after the function has completed,
 Returns
 	frequency - the frequency of the input
 	
+fft_real is the same transform for a real input (w need not be zeroed) at about half the cost;
+q[0..n/2] and w[0..n/2] come out as fft's bins, the rest of q and w is scratch.
+
+Default plan (static memory, generated twiddles, FFT_PLAN_MIN_N <= n <= 512):
+	fft_init         - sets it up for n = 2^m and resets its range, bins and interpolator; fft(), fft_real()
+	                   and fft_set_bins() need the same n and m (otherwise they return 0 / do nothing)
+	fft_set_range    - band the peak search looks at (default 80 Hz .. 4200 Hz)
+	fft_set_bins     - the output bins 0..n/2 fft_real computes (count = 0: all of them); only those are
+	                   valid afterwards, so the list must cover the search range. FFT_KERNEL_LEGACY never
+	                   prunes the transform, the list only switches to a Goertzel bank when that is cheaper
+	fft_get_peaks / fft_harmonic_fix - fft_plan_get_peaks / fft_plan_harmonic_fix on the last fft()/fft_real()
+	fft_default_plan - the default plan, for the plan calls
+
+Plan API (a plan per transform size, and per thread):
+	fft_plan_create    - plan for n = FFT_PLAN_MIN_N..FFT_PLAN_MAX_N (power of two) on the heap, NULL if n is
+	                     unsupported or out of memory
+	fft_plan_destroy   - frees it
+	fft_execute        - complex transform of q/w, then the peak search; returns the frequency and fills out
+	                     (if not NULL)
+	fft_execute_real   - the same with fft_real
+	fft_execute_real_batch - fft_execute_real on each of frames consecutive frames (frame f at q + f*n, w + f*n),
+	                     out[f] per frame
+	fft_plan_set_range / fft_plan_set_bins - as fft_set_range / fft_set_bins
+	fft_plan_set_interp - how the peak bin is refined (FFT_INTERP_*, default PARABOLIC); all of them assume a
+	                     Hann-windowed frame
+	fft_plan_set_peak_search - 0: transform only, frequency and peak_mag come back 0 (default 1)
+	fft_plan_set_spectrum - buffer for |X[k]|, k < count, filled by the real-input calls (frame f of a batch
+	                     at mag + f*count)
+	fft_plan_set_simd  - caps the SIMD level (FFT_SIMD_*) and returns the level in use (host builds only)
+	fft_plan_get_peaks - the k (<= FFT_MAX_PEAKS) strongest local maxima of the last search range (frame 0 of
+	                     a batch), strongest first, from the magnitudes the search stored; returns how many
+	fft_plan_harmonic_fix - octave correction: frequency / d if that subharmonic's own harmonics are strong
+	                     enough (FFT_HSUM_*), *divisor gets d
+	fft_interp_offset  - an interpolator's offset from the middle of three squared magnitudes (QUINN, which
+	                     needs the complex bins, falls back to JAIN)
+
+	fft_zoom        - refines a peak by fitting a sinusoid plus a constant to the windowed frame x (window
+	                  already applied, NULL for none) at points frequencies over f_center +- span_hz / 2;
+	                  returns the interpolated maximum of the fit
+	fft_build_frame - q[i] = (raw[i*decim] - dc) * scale * window[i] for i < n, dc the average of all raw_len
+	                  samples (window may be NULL)
 */
 
 #ifndef FFT_H
 #define FFT_H
 
+#include <stdint.h>
+
 #define PI 3.141592		//65358979323846
 
+/* FFT kernel selection (build flag, e.g. -DFFT_KERNEL=FFT_KERNEL_LEGACY) */
+#define FFT_KERNEL_LEGACY 0   // original reorder + copy-back kernel
+#define FFT_KERNEL_RADIX2 1   // in-place radix-2, single bit-reversal pass
+#define FFT_KERNEL_RADIX4 2   // in-place radix-4 passes + radix-2 cleanup for odd m
+
+#ifndef FFT_KERNEL
+#define FFT_KERNEL FFT_KERNEL_RADIX4
+#endif
+
+/* SIMD code paths for host builds (fft_simd.c), picked at run time; build flag, -DFFT_SIMD=0 turns them off */
+#define FFT_SIMD_SCALAR 0
+#define FFT_SIMD_SSE2   1
+#define FFT_SIMD_AVX2   2
+
+#ifndef FFT_SIMD
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define FFT_SIMD 1
+#else
+#define FFT_SIMD 0
+#endif
+#endif
+
+/* Peak interpolators (fft_plan_set_interp) */
+#define FFT_INTERP_PARABOLIC 0   // parabola through the squared magnitudes
+#define FFT_INTERP_GAUSSIAN  1   // parabola through the log magnitudes
+#define FFT_INTERP_JAIN      2   // magnitude ratio to the larger neighbor, Hann form
+#define FFT_INTERP_QUINN     3   // complex ratios to both neighbors, Hann form
+
+/* Octave correction (fft_plan_harmonic_fix) */
+#define FFT_HSUM_HARMONICS  6      // harmonics of the estimate that set the sum's ceiling
+#define FFT_HSUM_MAX_DIV    3      // subharmonics checked: frequency / 2, frequency / 3
+#define FFT_HSUM_MAX_PASSES 2      // repeated on the result, so 4 * f0 can come back to f0
+#define FFT_HSUM_FLOOR      0.005f // a candidate fundamental's squared magnitude vs the peak (-23 dB)
+#define FFT_HSUM_RATIO      0.25f  // in-between harmonics' average magnitude vs the estimate's own
+
+#define FFT_ZOOM_MAX_POINTS 64
+#define FFT_MAX_PEAKS       16
+
+#define FFT_PLAN_MIN_N 64
+#define FFT_PLAN_MAX_N 8192
+
+typedef struct fft_plan fft_plan;
+
+/* Result of one transform + peak search */
+typedef struct {
+	float frequency;    // interpolated peak frequency (Hz), 0 if no energy in range
+	float peak_mag;     // squared magnitude of the peak bin
+	int   peak_bin;     // bin index of the peak
+} fft_result;
+
+/* One spectral peak from fft_plan_get_peaks */
+typedef struct {
+	float frequency;    // interpolated frequency (Hz)
+	float mag;          // squared magnitude of the peak bin
+	int   bin;          // bin index
+} fft_peak_info;
+
+/* Plan API */
+fft_plan* fft_plan_create(int n);
+void fft_plan_destroy(fft_plan* p);
+fft_plan* fft_default_plan(void);
+void fft_plan_set_range(fft_plan* p, float f_min, float f_max);
+void fft_plan_set_bins(fft_plan* p, const int* bins, int count);
+float fft_execute(fft_plan* p, float* q, float* w, float sample_f, fft_result* out);
+float fft_execute_real(fft_plan* p, float* q, float* w, float sample_f, fft_result* out);
+void fft_execute_real_batch(fft_plan* p, float* q, float* w, int frames, float sample_f, fft_result* out);
+int fft_plan_set_simd(fft_plan* p, int level);
+void fft_plan_set_interp(fft_plan* p, int interp);
+void fft_plan_set_peak_search(fft_plan* p, int on);
+void fft_plan_set_spectrum(fft_plan* p, float* mag, int count);
+int fft_plan_get_peaks(const fft_plan* p, fft_peak_info* peaks, int k);
+float fft_plan_harmonic_fix(const fft_plan* p, float frequency, int* divisor);
+
+float fft_interp_offset(int interp, float y1, float y2, float y3, int n);
+
+/* Zoom-DFT refinement around a peak */
+float fft_zoom(const float* x, const float* window, int n, float sample_f, float f_center, float span_hz, int points);
+
+/* Frame building from raw stream grabber samples */
+void fft_build_frame(const int32_t* raw, int raw_len, int decim, int n, float scale, const float* window, float* q);
+
 /* FFT functions */
 float fft(float* q, float* w, int n, int m, float sample_f);
+float fft_real(float* q, float* w, int n, int m, float sample_f);
 void fft_init(int n, int m);
+void fft_set_range(float f_min, float f_max);
+void fft_set_bins(const int* bins, int count, int n, int m);
 float fft_get_last_peak_mag(void);
+int fft_get_peaks(fft_peak_info* peaks, int k);
+float fft_harmonic_fix(float frequency, int* divisor);
 
 #endif
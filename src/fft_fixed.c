@@ -0,0 +1,315 @@
+#include <stdint.h>
+#include <math.h>
+#include "fft_fixed.h"
+#include "fft_tables.h"
+
+#define MAX_M FFT_TABLE_M
+#define MAX_N FFT_TABLE_N
+
+#define F_MIN  80.0f    // E2 ~ 82.4 Hz
+#define F_MAX 4200.0f   // C7 ~ 4186 Hz
+
+#define Q15_HALF  (1 << 14)
+
+// block max allowed going into a butterfly stage: |x| < 2^14 keeps
+// x * Q15 twiddle sums below 2^30 and stage outputs below 2^16
+#define BFP_LIMIT (1 << 14)
+
+
+// working frame (real / imaginary), all values share one block exponent
+static int32_t fx_re[MAX_N];
+static int32_t fx_im[MAX_N];
+
+// squared magnitudes of the searched bins
+static uint32_t fx_mag[MAX_N / 2];
+
+// Q15 twiddle factors per stage, same layout as the float tables in fft.c
+static const int16_t* const Wq_real_stage[MAX_M] = {
+	fft_twiddle_re_q15 + 0,   fft_twiddle_re_q15 + 1,   fft_twiddle_re_q15 + 3,
+	fft_twiddle_re_q15 + 7,   fft_twiddle_re_q15 + 15,  fft_twiddle_re_q15 + 31,
+	fft_twiddle_re_q15 + 63,  fft_twiddle_re_q15 + 127, fft_twiddle_re_q15 + 255
+};
+static const int16_t* const Wq_imag_stage[MAX_M] = {
+	fft_twiddle_im_q15 + 0,   fft_twiddle_im_q15 + 1,   fft_twiddle_im_q15 + 3,
+	fft_twiddle_im_q15 + 7,   fft_twiddle_im_q15 + 15,  fft_twiddle_im_q15 + 31,
+	fft_twiddle_im_q15 + 63,  fft_twiddle_im_q15 + 127, fft_twiddle_im_q15 + 255
+};
+
+// value of an fx_re/fx_im entry in raw sample units is x * 2^block_exp
+static int block_exp = 0;
+
+// bins 0..n/2 valid after the last call
+static int last_half = 0;
+
+// peak magnitude from last call (raw sample units squared)
+static float last_peak_mag = 0.0f;
+
+
+/* Shifts the whole block down until its max magnitude is below BFP_LIMIT */
+static void bfp_normalize(int n) {
+	int i;
+	int32_t peak = 0;
+
+	for (i = 0; i < n; i++) {
+		int32_t a = fx_re[i] < 0 ? -fx_re[i] : fx_re[i];
+		int32_t b = fx_im[i] < 0 ? -fx_im[i] : fx_im[i];
+		if (a > peak) peak = a;
+		if (b > peak) peak = b;
+	}
+
+	int s = 0;
+	while ((peak >> s) >= BFP_LIMIT) s++;
+	if (s == 0) return;
+
+	for (i = 0; i < n; i++) {
+		fx_re[i] >>= s;
+		fx_im[i] >>= s;
+	}
+	block_exp += s;
+}
+
+
+/* In-place radix-2 kernel on fx_re/fx_im with block-floating-point scaling per stage */
+static void fft_fixed_core(int n, int m) {
+	int i, j, k, bit;
+	int32_t t;
+
+	// bit-reversal permutation
+	j = 0;
+	for (i = 0; i < n - 1; i++) {
+		if (i < j) {
+			t = fx_re[i]; fx_re[i] = fx_re[j]; fx_re[j] = t;
+			t = fx_im[i]; fx_im[i] = fx_im[j]; fx_im[j] = t;
+		}
+		bit = n >> 1;
+		while (j & bit) {
+			j ^= bit;
+			bit >>= 1;
+		}
+		j |= bit;
+	}
+
+	for (j = 0; j < m; j++) {
+		int half = 1 << j;
+		int span = half << 1;
+
+		bfp_normalize(n);
+
+		for (k = 0; k < half; k++) {
+			int32_t Wr = Wq_real_stage[j][k];
+			int32_t Wi = Wq_imag_stage[j][k];
+
+			for (i = k; i < n; i += span) {
+				int p = i + half;
+				int32_t a = fx_re[p];
+				int32_t b_im = fx_im[p];
+
+				// (a + j*b_im) * (Wr + j*Wi), rounded back to the block scale
+				int32_t real = (a * Wr - b_im * Wi + Q15_HALF) >> 15;
+				int32_t imagine = (a * Wi + b_im * Wr + Q15_HALF) >> 15;
+
+				fx_re[p] = fx_re[i] - real;
+				fx_im[p] = fx_im[i] - imagine;
+				fx_re[i] = fx_re[i] + real;
+				fx_im[i] = fx_im[i] + imagine;
+			}
+		}
+	}
+}
+
+
+/* Builds the frame: DC removal, decimation, input normalization, Hann window, real-input packing */
+static void fft_fixed_build(const int32_t* raw, int raw_len, int decim, int n) {
+	int i;
+	int half = n / 2;
+
+	int64_t sum = 0;
+	for (i = 0; i < raw_len; i++) {
+		sum += raw[i];
+	}
+	int32_t dc = (int32_t)(sum / raw_len);
+
+	// decimate + remove DC, track the largest sample
+	int32_t peak = 0;
+	for (i = 0; i < n; i++) {
+		int idx = i * decim;
+		int32_t x = (idx < raw_len) ? raw[idx] - dc : 0;
+		fx_re[i] = x;
+		if (x < 0) x = -x;
+		if (x > peak) peak = x;
+	}
+
+	// pick the input exponent so the frame uses the full Q15 range (max in [2^14, 2^15))
+	int s = 0;
+	while (peak >= (1 << 15)) {
+		peak >>= 1;
+		s++;
+	}
+	while (peak > 0 && peak < (1 << 14) && s > -16) {
+		peak <<= 1;
+		s--;
+	}
+	block_exp = s;
+
+	// scale + window, packing even samples as real and odd samples as imaginary
+	for (i = 0; i < half; i++) {
+		int32_t xe = fx_re[2 * i];
+		int32_t xo = fx_re[2 * i + 1];
+		if (s >= 0) {
+			xe >>= s;
+			xo >>= s;
+		} else {
+			xe <<= -s;
+			xo <<= -s;
+		}
+		fx_im[i] = (xo * fft_hann_q15[2 * i + 1] + Q15_HALF) >> 15;
+		fx_re[i] = (xe * fft_hann_q15[2 * i] + Q15_HALF) >> 15;
+	}
+}
+
+
+/* Splits the n/2-point result into bins 0..n/2 of the real input */
+static void fft_fixed_split(int n, int m) {
+	int k;
+	int half = n / 2;
+
+	bfp_normalize(half);
+
+	int32_t z0r = fx_re[0];
+	int32_t z0i = fx_im[0];
+	fx_re[0] = z0r + z0i;
+	fx_im[0] = 0;
+	fx_re[half] = z0r - z0i;
+	fx_im[half] = 0;
+
+	for (k = 1; k <= half / 2; k++) {
+		int32_t ar = fx_re[k];
+		int32_t ai = fx_im[k];
+		int32_t br = fx_re[half - k];
+		int32_t bi = fx_im[half - k];
+
+		// even / odd sub-spectra (factor 1/2 as a shift)
+		int32_t fe_re = (ar + br) >> 1;
+		int32_t fe_im = (ai - bi) >> 1;
+		int32_t fo_re = (ai + bi) >> 1;
+		int32_t fo_im = (br - ar) >> 1;
+
+		int32_t Wr = Wq_real_stage[m - 1][k];
+		int32_t Wi = Wq_imag_stage[m - 1][k];
+		int32_t tr = (fo_re * Wr - fo_im * Wi + Q15_HALF) >> 15;
+		int32_t ti = (fo_re * Wi + fo_im * Wr + Q15_HALF) >> 15;
+
+		fx_re[k] = fe_re + tr;
+		fx_im[k] = fe_im + ti;
+		fx_re[half - k] = fe_re - tr;
+		fx_im[half - k] = ti - fe_im;
+	}
+}
+
+
+/* Integer peak search over F_MIN..F_MAX, parabolic interpolation on the integer magnitudes */
+static float fft_fixed_peak(int n, float sample_f) {
+	int i, place;
+
+	float bin_spacing = sample_f / (float)n;
+
+	int start_bin = (int)(F_MIN / bin_spacing + 0.5f);
+	int end_bin = (int)(F_MAX / bin_spacing + 0.5f);
+
+	if (start_bin < 1) start_bin = 1;        // skip DC
+	if (end_bin > (n/2 - 1)) end_bin = (n/2 - 1);
+
+	// magnitudes one bin past each end too: a peak on the edge of the range (a low E just above the
+	// first bin) still has both neighbors for the interpolation, as in fft()
+	int lo_bin = start_bin - 1;
+	int hi_bin = end_bin + 1;
+	if (hi_bin > (n/2 - 1)) hi_bin = (n/2 - 1);
+
+	// shift so |re|,|im| < 2^14: every mag2 fits in 29 bits and the
+	// interpolation denominator can't overflow
+	int32_t peak = 0;
+	for (i = lo_bin; i <= hi_bin; i++) {
+		int32_t a = fx_re[i] < 0 ? -fx_re[i] : fx_re[i];
+		int32_t b = fx_im[i] < 0 ? -fx_im[i] : fx_im[i];
+		if (a > peak) peak = a;
+		if (b > peak) peak = b;
+	}
+	int s = 0;
+	while ((peak >> s) >= BFP_LIMIT) s++;
+
+	uint32_t max = 0;
+	place = start_bin;
+
+	for (i = lo_bin; i <= hi_bin; i++) {
+		int32_t re = fx_re[i] >> s;
+		int32_t im = fx_im[i] >> s;
+		uint32_t mag2 = (uint32_t)(re * re) + (uint32_t)(im * im);
+		fx_mag[i] = mag2;
+
+		if (mag2 > max && i >= start_bin && i <= end_bin) {
+			max = mag2;
+			place = i;
+		}
+	}
+
+	// back to raw sample units (only per-frame scalars use float from here on)
+	last_peak_mag = ldexpf((float)max, 2 * (block_exp + s));
+
+	if (max == 0) {
+		return 0.0f;
+	}
+
+	if (place <= 1 || place >= hi_bin) {
+		return bin_spacing * (float)place;
+	}
+
+	// 3-point parabolic interpolation around the peak
+	int32_t y1 = (int32_t)fx_mag[place - 1];
+	int32_t y2 = (int32_t)fx_mag[place];
+	int32_t y3 = (int32_t)fx_mag[place + 1];
+
+	int32_t denom = y1 - 2 * y2 + y3;
+	float delta = 0.0f;
+
+	if (denom != 0) {
+		delta = 0.5f * (float)(y1 - y3) / (float)denom;
+
+		if (delta < -1.0f) delta = -1.0f;
+		if (delta >  1.0f) delta =  1.0f;
+	}
+
+	return ((float)place + delta) * bin_spacing;
+}
+
+
+/* Fixed-point pitch pipeline straight from the raw stream grabber samples */
+float fft_fixed(const int32_t* raw, int raw_len, int decim, int n, int m, float sample_f) {
+	fft_fixed_build(raw, raw_len, decim, n);
+	fft_fixed_core(n / 2, m - 1);
+	fft_fixed_split(n, m);
+	last_half = n / 2;
+	return fft_fixed_peak(n, sample_f);
+}
+
+
+/* Getter */
+float fft_fixed_get_last_peak_mag(void) {
+	return last_peak_mag;
+}
+
+
+/* Magnitudes |X[k]| of the first count bins from the last call (raw sample units) */
+void fft_fixed_get_mag(float* mag, int count) {
+	int i;
+	float unit = ldexpf(1.0f, block_exp);
+
+	for (i = 0; i < count; i++) {
+		if (i > last_half) {
+			mag[i] = 0.0f;
+			continue;
+		}
+		float re = (float)fx_re[i];
+		float im = (float)fx_im[i];
+		mag[i] = sqrtf(re * re + im * im) * unit;
+	}
+}
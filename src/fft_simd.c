@@ -0,0 +1,393 @@
+#include "fft_simd.h"
+
+#if FFT_SIMD
+
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define AVX2_FN __attribute__((target("avx2")))
+
+// CPUID leaf 1 / leaf 7 feature bits
+#define CPUID1_EDX_SSE2    (1u << 26)
+#define CPUID1_ECX_OSXSAVE (1u << 27)
+#define CPUID1_ECX_AVX     (1u << 28)
+#define CPUID7_EBX_AVX2    (1u << 5)
+
+// XCR0: SSE and AVX register state enabled by the OS
+#define XCR0_SSE_AVX 0x6u
+
+
+/* Best instruction set this CPU (and OS) supports, FFT_SIMD_SCALAR / SSE2 / AVX2; cached after the first call */
+int fft_simd_detect(void) {
+	static volatile int level = -1;
+	unsigned int a, b, c, d;
+
+	if (level >= 0) return level;
+
+	int found = FFT_SIMD_SCALAR;
+	if (__get_cpuid(1, &a, &b, &c, &d)) {
+		if (d & CPUID1_EDX_SSE2) found = FFT_SIMD_SSE2;
+
+		if ((c & CPUID1_ECX_OSXSAVE) && (c & CPUID1_ECX_AVX)) {
+			unsigned int xcr0_lo, xcr0_hi;
+			__asm__ volatile ("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+			(void)xcr0_hi;
+
+			if ((xcr0_lo & XCR0_SSE_AVX) == XCR0_SSE_AVX && __get_cpuid_count(7, 0, &a, &b, &c, &d)
+			    && (b & CPUID7_EBX_AVX2)) {
+				found = FFT_SIMD_AVX2;
+			}
+		}
+	}
+
+	level = found;
+	return found;
+}
+
+
+/* Radix-4 pass over 4 columns at a time, same butterfly as the scalar kernel in fft.c */
+void fft_simd_r4_pass_sse2(float* q, float* w, int total, int h, const float* T1r, const float* T1i,
+                           const float* T2r, const float* T2i, const unsigned char* cols) {
+	int i, k;
+	int span = h << 2;
+
+	for (k = 0; k < h; k += 4) {
+		if (cols && !(cols[k] | cols[k + 1] | cols[k + 2] | cols[k + 3])) continue;
+
+		__m128 W1r = _mm_loadu_ps(T1r + k);
+		__m128 W1i = _mm_loadu_ps(T1i + k);
+		__m128 W2r = _mm_loadu_ps(T2r + k);
+		__m128 W2i = _mm_loadu_ps(T2i + k);
+		// W^3k = W^k * W^2k, no wrap-around lookup needed
+		__m128 W3r = _mm_sub_ps(_mm_mul_ps(W1r, W2r), _mm_mul_ps(W1i, W2i));
+		__m128 W3i = _mm_add_ps(_mm_mul_ps(W1r, W2i), _mm_mul_ps(W1i, W2r));
+
+		for (i = k; i < total; i += span) {
+			float* q1 = q + i + h;
+			float* w1 = w + i + h;
+			float* q2 = q1 + h;
+			float* w2 = w1 + h;
+			float* q3 = q2 + h;
+			float* w3 = w2 + h;
+
+			__m128 a1r = _mm_loadu_ps(q1), a1i = _mm_loadu_ps(w1);
+			__m128 a2r = _mm_loadu_ps(q2), a2i = _mm_loadu_ps(w2);
+			__m128 a3r = _mm_loadu_ps(q3), a3i = _mm_loadu_ps(w3);
+
+			__m128 br = _mm_sub_ps(_mm_mul_ps(a1r, W2r), _mm_mul_ps(a1i, W2i));
+			__m128 bi = _mm_add_ps(_mm_mul_ps(a1r, W2i), _mm_mul_ps(a1i, W2r));
+			__m128 cr = _mm_sub_ps(_mm_mul_ps(a2r, W1r), _mm_mul_ps(a2i, W1i));
+			__m128 ci = _mm_add_ps(_mm_mul_ps(a2r, W1i), _mm_mul_ps(a2i, W1r));
+			__m128 dr = _mm_sub_ps(_mm_mul_ps(a3r, W3r), _mm_mul_ps(a3i, W3i));
+			__m128 di = _mm_add_ps(_mm_mul_ps(a3r, W3i), _mm_mul_ps(a3i, W3r));
+
+			__m128 a0r = _mm_loadu_ps(q + i), a0i = _mm_loadu_ps(w + i);
+			__m128 s0r = _mm_add_ps(a0r, br), s0i = _mm_add_ps(a0i, bi);
+			__m128 s1r = _mm_sub_ps(a0r, br), s1i = _mm_sub_ps(a0i, bi);
+			__m128 s2r = _mm_add_ps(cr, dr),  s2i = _mm_add_ps(ci, di);
+			__m128 s3r = _mm_sub_ps(cr, dr),  s3i = _mm_sub_ps(ci, di);
+
+			_mm_storeu_ps(q + i, _mm_add_ps(s0r, s2r));
+			_mm_storeu_ps(w + i, _mm_add_ps(s0i, s2i));
+			_mm_storeu_ps(q2, _mm_sub_ps(s0r, s2r));
+			_mm_storeu_ps(w2, _mm_sub_ps(s0i, s2i));
+			// s1 -/+ j*s3
+			_mm_storeu_ps(q1, _mm_add_ps(s1r, s3i));
+			_mm_storeu_ps(w1, _mm_sub_ps(s1i, s3r));
+			_mm_storeu_ps(q3, _mm_sub_ps(s1r, s3i));
+			_mm_storeu_ps(w3, _mm_add_ps(s1i, s3r));
+		}
+	}
+}
+
+
+/* Radix-4 pass over 8 columns at a time */
+AVX2_FN void fft_simd_r4_pass_avx2(float* q, float* w, int total, int h, const float* T1r, const float* T1i,
+                                   const float* T2r, const float* T2i, const unsigned char* cols) {
+	int i, k;
+	int span = h << 2;
+
+	for (k = 0; k < h; k += 8) {
+		if (cols && !(cols[k] | cols[k + 1] | cols[k + 2] | cols[k + 3]
+		              | cols[k + 4] | cols[k + 5] | cols[k + 6] | cols[k + 7])) continue;
+
+		__m256 W1r = _mm256_loadu_ps(T1r + k);
+		__m256 W1i = _mm256_loadu_ps(T1i + k);
+		__m256 W2r = _mm256_loadu_ps(T2r + k);
+		__m256 W2i = _mm256_loadu_ps(T2i + k);
+		__m256 W3r = _mm256_sub_ps(_mm256_mul_ps(W1r, W2r), _mm256_mul_ps(W1i, W2i));
+		__m256 W3i = _mm256_add_ps(_mm256_mul_ps(W1r, W2i), _mm256_mul_ps(W1i, W2r));
+
+		for (i = k; i < total; i += span) {
+			float* q1 = q + i + h;
+			float* w1 = w + i + h;
+			float* q2 = q1 + h;
+			float* w2 = w1 + h;
+			float* q3 = q2 + h;
+			float* w3 = w2 + h;
+
+			__m256 a1r = _mm256_loadu_ps(q1), a1i = _mm256_loadu_ps(w1);
+			__m256 a2r = _mm256_loadu_ps(q2), a2i = _mm256_loadu_ps(w2);
+			__m256 a3r = _mm256_loadu_ps(q3), a3i = _mm256_loadu_ps(w3);
+
+			__m256 br = _mm256_sub_ps(_mm256_mul_ps(a1r, W2r), _mm256_mul_ps(a1i, W2i));
+			__m256 bi = _mm256_add_ps(_mm256_mul_ps(a1r, W2i), _mm256_mul_ps(a1i, W2r));
+			__m256 cr = _mm256_sub_ps(_mm256_mul_ps(a2r, W1r), _mm256_mul_ps(a2i, W1i));
+			__m256 ci = _mm256_add_ps(_mm256_mul_ps(a2r, W1i), _mm256_mul_ps(a2i, W1r));
+			__m256 dr = _mm256_sub_ps(_mm256_mul_ps(a3r, W3r), _mm256_mul_ps(a3i, W3i));
+			__m256 di = _mm256_add_ps(_mm256_mul_ps(a3r, W3i), _mm256_mul_ps(a3i, W3r));
+
+			__m256 a0r = _mm256_loadu_ps(q + i), a0i = _mm256_loadu_ps(w + i);
+			__m256 s0r = _mm256_add_ps(a0r, br), s0i = _mm256_add_ps(a0i, bi);
+			__m256 s1r = _mm256_sub_ps(a0r, br), s1i = _mm256_sub_ps(a0i, bi);
+			__m256 s2r = _mm256_add_ps(cr, dr),  s2i = _mm256_add_ps(ci, di);
+			__m256 s3r = _mm256_sub_ps(cr, dr),  s3i = _mm256_sub_ps(ci, di);
+
+			_mm256_storeu_ps(q + i, _mm256_add_ps(s0r, s2r));
+			_mm256_storeu_ps(w + i, _mm256_add_ps(s0i, s2i));
+			_mm256_storeu_ps(q2, _mm256_sub_ps(s0r, s2r));
+			_mm256_storeu_ps(w2, _mm256_sub_ps(s0i, s2i));
+			_mm256_storeu_ps(q1, _mm256_add_ps(s1r, s3i));
+			_mm256_storeu_ps(w1, _mm256_sub_ps(s1i, s3r));
+			_mm256_storeu_ps(q3, _mm256_sub_ps(s1r, s3i));
+			_mm256_storeu_ps(w3, _mm256_add_ps(s1i, s3r));
+		}
+	}
+}
+
+
+/* Radix-2 stage over 4 columns at a time, same butterfly as the scalar kernel in fft.c */
+void fft_simd_r2_stage_sse2(float* q, float* w, int total, int half, const float* Tr, const float* Ti,
+                            const unsigned char* cols) {
+	int i, k;
+	int span = half << 1;
+
+	for (k = 0; k < half; k += 4) {
+		if (cols && !(cols[k] | cols[k + 1] | cols[k + 2] | cols[k + 3])) continue;
+
+		__m128 Wr = _mm_loadu_ps(Tr + k);
+		__m128 Wi = _mm_loadu_ps(Ti + k);
+
+		for (i = k; i < total; i += span) {
+			__m128 a = _mm_loadu_ps(q + i + half);
+			__m128 b_im = _mm_loadu_ps(w + i + half);
+			__m128 real = _mm_sub_ps(_mm_mul_ps(a, Wr), _mm_mul_ps(b_im, Wi));
+			__m128 imagine = _mm_add_ps(_mm_mul_ps(a, Wi), _mm_mul_ps(b_im, Wr));
+			__m128 xr = _mm_loadu_ps(q + i);
+			__m128 xi = _mm_loadu_ps(w + i);
+
+			_mm_storeu_ps(q + i + half, _mm_sub_ps(xr, real));
+			_mm_storeu_ps(w + i + half, _mm_sub_ps(xi, imagine));
+			_mm_storeu_ps(q + i, _mm_add_ps(xr, real));
+			_mm_storeu_ps(w + i, _mm_add_ps(xi, imagine));
+		}
+	}
+}
+
+
+/* Radix-2 stage over 8 columns at a time */
+AVX2_FN void fft_simd_r2_stage_avx2(float* q, float* w, int total, int half, const float* Tr, const float* Ti,
+                                    const unsigned char* cols) {
+	int i, k;
+	int span = half << 1;
+
+	for (k = 0; k < half; k += 8) {
+		if (cols && !(cols[k] | cols[k + 1] | cols[k + 2] | cols[k + 3]
+		              | cols[k + 4] | cols[k + 5] | cols[k + 6] | cols[k + 7])) continue;
+
+		__m256 Wr = _mm256_loadu_ps(Tr + k);
+		__m256 Wi = _mm256_loadu_ps(Ti + k);
+
+		for (i = k; i < total; i += span) {
+			__m256 a = _mm256_loadu_ps(q + i + half);
+			__m256 b_im = _mm256_loadu_ps(w + i + half);
+			__m256 real = _mm256_sub_ps(_mm256_mul_ps(a, Wr), _mm256_mul_ps(b_im, Wi));
+			__m256 imagine = _mm256_add_ps(_mm256_mul_ps(a, Wi), _mm256_mul_ps(b_im, Wr));
+			__m256 xr = _mm256_loadu_ps(q + i);
+			__m256 xi = _mm256_loadu_ps(w + i);
+
+			_mm256_storeu_ps(q + i + half, _mm256_sub_ps(xr, real));
+			_mm256_storeu_ps(w + i + half, _mm256_sub_ps(xi, imagine));
+			_mm256_storeu_ps(q + i, _mm256_add_ps(xr, real));
+			_mm256_storeu_ps(w + i, _mm256_add_ps(xi, imagine));
+		}
+	}
+}
+
+
+/* Picks the lane with the largest value, lowest bin on ties (first maximum like the scalar search) */
+static int magmax_reduce(const float* lane_max, const int* lane_idx, int lanes, float* max) {
+	int l;
+	float best = lane_max[0];
+	int place = lane_idx[0];
+
+	for (l = 1; l < lanes; l++) {
+		if (lane_max[l] > best || (lane_max[l] == best && lane_idx[l] < place)) {
+			best = lane_max[l];
+			place = lane_idx[l];
+		}
+	}
+	*max = best;
+	return place;
+}
+
+
+/* Squared magnitudes of bins start..end into mag, returns the first bin holding the maximum */
+int fft_simd_magmax_sse2(const float* q, const float* w, float* mag, int start, int end, float* max) {
+	int i, place;
+	float lane_max[4];
+	int lane_idx[4];
+
+	__m128 vmax = _mm_setzero_ps();
+	__m128i vidx = _mm_set1_epi32(start);
+	__m128i cur = _mm_setr_epi32(start, start + 1, start + 2, start + 3);
+	const __m128i four = _mm_set1_epi32(4);
+
+	for (i = start; i + 3 <= end; i += 4) {
+		__m128 re = _mm_loadu_ps(q + i);
+		__m128 im = _mm_loadu_ps(w + i);
+		__m128 mag2 = _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im));
+		_mm_storeu_ps(mag + i, mag2);
+
+		// strict > keeps the first maximum per lane
+		__m128 gt = _mm_cmpgt_ps(mag2, vmax);
+		__m128i gti = _mm_castps_si128(gt);
+		vmax = _mm_or_ps(_mm_and_ps(gt, mag2), _mm_andnot_ps(gt, vmax));
+		vidx = _mm_or_si128(_mm_and_si128(gti, cur), _mm_andnot_si128(gti, vidx));
+		cur = _mm_add_epi32(cur, four);
+	}
+
+	_mm_storeu_ps(lane_max, vmax);
+	_mm_storeu_si128((__m128i*)lane_idx, vidx);
+	place = magmax_reduce(lane_max, lane_idx, 4, max);
+
+	// remaining bins come after every lane's bins, so strict > still finds the first maximum
+	for (; i <= end; i++) {
+		float mag2 = q[i] * q[i] + w[i] * w[i];
+		mag[i] = mag2;
+		if (mag2 > *max) {
+			*max = mag2;
+			place = i;
+		}
+	}
+	return place;
+}
+
+
+/* Squared magnitudes of bins start..end into mag, 8 bins at a time */
+AVX2_FN int fft_simd_magmax_avx2(const float* q, const float* w, float* mag, int start, int end, float* max) {
+	int i, place;
+	float lane_max[8];
+	int lane_idx[8];
+
+	__m256 vmax = _mm256_setzero_ps();
+	__m256i vidx = _mm256_set1_epi32(start);
+	__m256i cur = _mm256_setr_epi32(start, start + 1, start + 2, start + 3,
+	                                start + 4, start + 5, start + 6, start + 7);
+	const __m256i eight = _mm256_set1_epi32(8);
+
+	for (i = start; i + 7 <= end; i += 8) {
+		__m256 re = _mm256_loadu_ps(q + i);
+		__m256 im = _mm256_loadu_ps(w + i);
+		__m256 mag2 = _mm256_add_ps(_mm256_mul_ps(re, re), _mm256_mul_ps(im, im));
+		_mm256_storeu_ps(mag + i, mag2);
+
+		__m256 gt = _mm256_cmp_ps(mag2, vmax, _CMP_GT_OQ);
+		vmax = _mm256_blendv_ps(vmax, mag2, gt);
+		vidx = _mm256_blendv_epi8(vidx, cur, _mm256_castps_si256(gt));
+		cur = _mm256_add_epi32(cur, eight);
+	}
+
+	_mm256_storeu_ps(lane_max, vmax);
+	_mm256_storeu_si256((__m256i*)lane_idx, vidx);
+	place = magmax_reduce(lane_max, lane_idx, 8, max);
+
+	for (; i <= end; i++) {
+		float mag2 = q[i] * q[i] + w[i] * w[i];
+		mag[i] = mag2;
+		if (mag2 > *max) {
+			*max = mag2;
+			place = i;
+		}
+	}
+	return place;
+}
+
+
+/* Frame building (see fft_build_frame): int64 DC sum, then 4 decimated samples per step */
+void fft_simd_frame_sse2(const int32_t* raw, int raw_len, int decim, int n, float scale,
+                         const float* window, float* q) {
+	int i;
+	int64_t sum_lanes[2];
+
+	__m128i acc = _mm_setzero_si128();
+	for (i = 0; i + 4 <= raw_len; i += 4) {
+		__m128i x = _mm_loadu_si128((const __m128i*)(raw + i));
+		// sign-extend to 64 bits before adding
+		__m128i sign = _mm_srai_epi32(x, 31);
+		acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(x, sign));
+		acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(x, sign));
+	}
+	_mm_storeu_si128((__m128i*)sum_lanes, acc);
+	int64_t sum = sum_lanes[0] + sum_lanes[1];
+	for (; i < raw_len; i++) {
+		sum += raw[i];
+	}
+	int32_t dc = (int32_t)(sum / raw_len);
+
+	__m128i vdc = _mm_set1_epi32(dc);
+	__m128 vscale = _mm_set1_ps(scale);
+
+	for (i = 0; i + 4 <= n && (i + 3) * decim < raw_len; i += 4) {
+		__m128i x = _mm_setr_epi32(raw[i * decim], raw[(i + 1) * decim],
+		                           raw[(i + 2) * decim], raw[(i + 3) * decim]);
+		__m128 v = _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(x, vdc)), vscale);
+		if (window) v = _mm_mul_ps(v, _mm_loadu_ps(window + i));
+		_mm_storeu_ps(q + i, v);
+	}
+	for (; i < n; i++) {
+		int idx = i * decim;
+		q[i] = (idx < raw_len) ? (float)(raw[idx] - dc) * scale : 0.0f;
+		if (window) q[i] *= window[i];
+	}
+}
+
+
+/* Frame building, 8 samples per step with a strided gather */
+AVX2_FN void fft_simd_frame_avx2(const int32_t* raw, int raw_len, int decim, int n, float scale,
+                                 const float* window, float* q) {
+	int i;
+	int64_t sum_lanes[4];
+
+	__m256i acc = _mm256_setzero_si256();
+	for (i = 0; i + 8 <= raw_len; i += 8) {
+		__m128i lo = _mm_loadu_si128((const __m128i*)(raw + i));
+		__m128i hi = _mm_loadu_si128((const __m128i*)(raw + i + 4));
+		acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(lo));
+		acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(hi));
+	}
+	_mm256_storeu_si256((__m256i*)sum_lanes, acc);
+	int64_t sum = sum_lanes[0] + sum_lanes[1] + sum_lanes[2] + sum_lanes[3];
+	for (; i < raw_len; i++) {
+		sum += raw[i];
+	}
+	int32_t dc = (int32_t)(sum / raw_len);
+
+	__m256i vdc = _mm256_set1_epi32(dc);
+	__m256 vscale = _mm256_set1_ps(scale);
+	__m256i offs = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(decim));
+
+	for (i = 0; i + 8 <= n && (i + 7) * decim < raw_len; i += 8) {
+		__m256i x = _mm256_i32gather_epi32((const int*)(raw + i * decim), offs, 4);
+		__m256 v = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(x, vdc)), vscale);
+		if (window) v = _mm256_mul_ps(v, _mm256_loadu_ps(window + i));
+		_mm256_storeu_ps(q + i, v);
+	}
+	for (; i < n; i++) {
+		int idx = i * decim;
+		q[i] = (idx < raw_len) ? (float)(raw[idx] - dc) * scale : 0.0f;
+		if (window) q[i] *= window[i];
+	}
+}
+
+#endif /* FFT_SIMD */
@@ -0,0 +1,51 @@
+/*
+SSE2 / AVX2 versions of the hot loops in fft.c, for host (x86) builds that run the tuner's DSP
+on recorded audio. fft.c picks them at run time from fft_simd_detect() (CPUID + OS support for the
+AVX state) and keeps the portable scalar code for everything else; on MicroBlaze FFT_SIMD is 0 and
+this file compiles to nothing.
+	fft_simd_r4_pass_*  - one radix-4 pass (stages j, j+1) of the radix-4 kernel, h >= 4 (SSE2) / 8 (AVX2)
+	fft_simd_r2_stage_* - one stage of the radix-2 kernel, half >= 4 / 8
+	fft_simd_magmax_*   - squared magnitudes of bins start..end into mag, returns the first bin of the maximum
+	fft_simd_frame_*    - DC removal, decimation, int32 -> float scale and window (fft_build_frame)
+cols is the pass's column mask (already offset to the pass) or NULL; a group of 4 / 8 columns is
+skipped only if none of them is needed.
+
+Tolerance against the scalar path
+	magnitude / argmax, frame building and the radix-2 stages use the same operations in the same
+	order (no FMA), so they are bit-identical.
+	The radix-4 passes form W^3k as W^k * W^2k instead of reading it from the table, so spectra differ
+	from the scalar kernel by rounding only: every bin is within 1e-6 of the frame's peak magnitude
+	(n = 64..8192), peak bins are identical and interpolated frequencies agree within 0.001 cents.
+*/
+
+#ifndef FFT_SIMD_H
+#define FFT_SIMD_H
+
+#include <stdint.h>
+#include "fft.h"
+
+#if FFT_SIMD
+
+int fft_simd_detect(void);
+
+void fft_simd_r4_pass_sse2(float* q, float* w, int total, int h, const float* T1r, const float* T1i,
+                           const float* T2r, const float* T2i, const unsigned char* cols);
+void fft_simd_r4_pass_avx2(float* q, float* w, int total, int h, const float* T1r, const float* T1i,
+                           const float* T2r, const float* T2i, const unsigned char* cols);
+
+void fft_simd_r2_stage_sse2(float* q, float* w, int total, int half, const float* Tr, const float* Ti,
+                            const unsigned char* cols);
+void fft_simd_r2_stage_avx2(float* q, float* w, int total, int half, const float* Tr, const float* Ti,
+                            const unsigned char* cols);
+
+int fft_simd_magmax_sse2(const float* q, const float* w, float* mag, int start, int end, float* max);
+int fft_simd_magmax_avx2(const float* q, const float* w, float* mag, int start, int end, float* max);
+
+void fft_simd_frame_sse2(const int32_t* raw, int raw_len, int decim, int n, float scale,
+                         const float* window, float* q);
+void fft_simd_frame_avx2(const int32_t* raw, int raw_len, int decim, int n, float scale,
+                         const float* window, float* q);
+
+#endif /* FFT_SIMD */
+
+#endif
@@ -0,0 +1,501 @@
+/* Generated by tools/gen_tables.c, do not edit. */
+
+#include <stdint.h>
+#include "fft_tables.h"
+
+const float fft_twiddle_re[511] = {
+	1.0f, 1.0f, 0.0f, 1.0f, 0.707106781f, 0.0f,
+	-0.707106781f, 1.0f, 0.923879533f, 0.707106781f, 0.382683432f, 0.0f,
+	-0.382683432f, -0.707106781f, -0.923879533f, 1.0f, 0.98078528f, 0.923879533f,
+	0.831469612f, 0.707106781f, 0.555570233f, 0.382683432f, 0.195090322f, 0.0f,
+	-0.195090322f, -0.382683432f, -0.555570233f, -0.707106781f, -0.831469612f, -0.923879533f,
+	-0.98078528f, 1.0f, 0.995184727f, 0.98078528f, 0.956940336f, 0.923879533f,
+	0.881921264f, 0.831469612f, 0.773010453f, 0.707106781f, 0.634393284f, 0.555570233f,
+	0.471396737f, 0.382683432f, 0.290284677f, 0.195090322f, 0.0980171403f, 0.0f,
+	-0.0980171403f, -0.195090322f, -0.290284677f, -0.382683432f, -0.471396737f, -0.555570233f,
+	-0.634393284f, -0.707106781f, -0.773010453f, -0.831469612f, -0.881921264f, -0.923879533f,
+	-0.956940336f, -0.98078528f, -0.995184727f, 1.0f, 0.998795456f, 0.995184727f,
+	0.98917651f, 0.98078528f, 0.970031253f, 0.956940336f, 0.941544065f, 0.923879533f,
+	0.903989293f, 0.881921264f, 0.85772861f, 0.831469612f, 0.803207531f, 0.773010453f,
+	0.740951125f, 0.707106781f, 0.671558955f, 0.634393284f, 0.595699304f, 0.555570233f,
+	0.514102744f, 0.471396737f, 0.427555093f, 0.382683432f, 0.336889853f, 0.290284677f,
+	0.24298018f, 0.195090322f, 0.146730474f, 0.0980171403f, 0.0490676743f, 0.0f,
+	-0.0490676743f, -0.0980171403f, -0.146730474f, -0.195090322f, -0.24298018f, -0.290284677f,
+	-0.336889853f, -0.382683432f, -0.427555093f, -0.471396737f, -0.514102744f, -0.555570233f,
+	-0.595699304f, -0.634393284f, -0.671558955f, -0.707106781f, -0.740951125f, -0.773010453f,
+	-0.803207531f, -0.831469612f, -0.85772861f, -0.881921264f, -0.903989293f, -0.923879533f,
+	-0.941544065f, -0.956940336f, -0.970031253f, -0.98078528f, -0.98917651f, -0.995184727f,
+	-0.998795456f, 1.0f, 0.999698819f, 0.998795456f, 0.997290457f, 0.995184727f,
+	0.992479535f, 0.98917651f, 0.985277642f, 0.98078528f, 0.97570213f, 0.970031253f,
+	0.963776066f, 0.956940336f, 0.949528181f, 0.941544065f, 0.932992799f, 0.923879533f,
+	0.914209756f, 0.903989293f, 0.893224301f, 0.881921264f, 0.870086991f, 0.85772861f,
+	0.844853565f, 0.831469612f, 0.817584813f, 0.803207531f, 0.788346428f, 0.773010453f,
+	0.757208847f, 0.740951125f, 0.724247083f, 0.707106781f, 0.689540545f, 0.671558955f,
+	0.653172843f, 0.634393284f, 0.615231591f, 0.595699304f, 0.575808191f, 0.555570233f,
+	0.53499762f, 0.514102744f, 0.492898192f, 0.471396737f, 0.44961133f, 0.427555093f,
+	0.405241314f, 0.382683432f, 0.359895037f, 0.336889853f, 0.31368174f, 0.290284677f,
+	0.266712757f, 0.24298018f, 0.21910124f, 0.195090322f, 0.170961889f, 0.146730474f,
+	0.122410675f, 0.0980171403f, 0.0735645636f, 0.0490676743f, 0.0245412285f, 0.0f,
+	-0.0245412285f, -0.0490676743f, -0.0735645636f, -0.0980171403f, -0.122410675f, -0.146730474f,
+	-0.170961889f, -0.195090322f, -0.21910124f, -0.24298018f, -0.266712757f, -0.290284677f,
+	-0.31368174f, -0.336889853f, -0.359895037f, -0.382683432f, -0.405241314f, -0.427555093f,
+	-0.44961133f, -0.471396737f, -0.492898192f, -0.514102744f, -0.53499762f, -0.555570233f,
+	-0.575808191f, -0.595699304f, -0.615231591f, -0.634393284f, -0.653172843f, -0.671558955f,
+	-0.689540545f, -0.707106781f, -0.724247083f, -0.740951125f, -0.757208847f, -0.773010453f,
+	-0.788346428f, -0.803207531f, -0.817584813f, -0.831469612f, -0.844853565f, -0.85772861f,
+	-0.870086991f, -0.881921264f, -0.893224301f, -0.903989293f, -0.914209756f, -0.923879533f,
+	-0.932992799f, -0.941544065f, -0.949528181f, -0.956940336f, -0.963776066f, -0.970031253f,
+	-0.97570213f, -0.98078528f, -0.985277642f, -0.98917651f, -0.992479535f, -0.995184727f,
+	-0.997290457f, -0.998795456f, -0.999698819f, 1.0f, 0.999924702f, 0.999698819f,
+	0.999322385f, 0.998795456f, 0.998118113f, 0.997290457f, 0.996312612f, 0.995184727f,
+	0.99390697f, 0.992479535f, 0.990902635f, 0.98917651f, 0.987301418f, 0.985277642f,
+	0.983105487f, 0.98078528f, 0.978317371f, 0.97570213f, 0.972939952f, 0.970031253f,
+	0.966976471f, 0.963776066f, 0.960430519f, 0.956940336f, 0.95330604f, 0.949528181f,
+	0.945607325f, 0.941544065f, 0.937339012f, 0.932992799f, 0.92850608f, 0.923879533f,
+	0.919113852f, 0.914209756f, 0.909167983f, 0.903989293f, 0.898674466f, 0.893224301f,
+	0.88763962f, 0.881921264f, 0.876070094f, 0.870086991f, 0.863972856f, 0.85772861f,
+	0.851355193f, 0.844853565f, 0.838224706f, 0.831469612f, 0.824589303f, 0.817584813f,
+	0.810457198f, 0.803207531f, 0.795836905f, 0.788346428f, 0.780737229f, 0.773010453f,
+	0.765167266f, 0.757208847f, 0.749136395f, 0.740951125f, 0.732654272f, 0.724247083f,
+	0.715730825f, 0.707106781f, 0.698376249f, 0.689540545f, 0.680600998f, 0.671558955f,
+	0.662415778f, 0.653172843f, 0.643831543f, 0.634393284f, 0.624859488f, 0.615231591f,
+	0.605511041f, 0.595699304f, 0.585797857f, 0.575808191f, 0.565731811f, 0.555570233f,
+	0.545324988f, 0.53499762f, 0.524589683f, 0.514102744f, 0.503538384f, 0.492898192f,
+	0.482183772f, 0.471396737f, 0.460538711f, 0.44961133f, 0.438616239f, 0.427555093f,
+	0.41642956f, 0.405241314f, 0.39399204f, 0.382683432f, 0.371317194f, 0.359895037f,
+	0.34841868f, 0.336889853f, 0.325310292f, 0.31368174f, 0.302005949f, 0.290284677f,
+	0.278519689f, 0.266712757f, 0.25486566f, 0.24298018f, 0.231058108f, 0.21910124f,
+	0.207111376f, 0.195090322f, 0.183039888f, 0.170961889f, 0.158858143f, 0.146730474f,
+	0.134580709f, 0.122410675f, 0.110222207f, 0.0980171403f, 0.0857973123f, 0.0735645636f,
+	0.0613207363f, 0.0490676743f, 0.0368072229f, 0.0245412285f, 0.0122715383f, 0.0f,
+	-0.0122715383f, -0.0245412285f, -0.0368072229f, -0.0490676743f, -0.0613207363f, -0.0735645636f,
+	-0.0857973123f, -0.0980171403f, -0.110222207f, -0.122410675f, -0.134580709f, -0.146730474f,
+	-0.158858143f, -0.170961889f, -0.183039888f, -0.195090322f, -0.207111376f, -0.21910124f,
+	-0.231058108f, -0.24298018f, -0.25486566f, -0.266712757f, -0.278519689f, -0.290284677f,
+	-0.302005949f, -0.31368174f, -0.325310292f, -0.336889853f, -0.34841868f, -0.359895037f,
+	-0.371317194f, -0.382683432f, -0.39399204f, -0.405241314f, -0.41642956f, -0.427555093f,
+	-0.438616239f, -0.44961133f, -0.460538711f, -0.471396737f, -0.482183772f, -0.492898192f,
+	-0.503538384f, -0.514102744f, -0.524589683f, -0.53499762f, -0.545324988f, -0.555570233f,
+	-0.565731811f, -0.575808191f, -0.585797857f, -0.595699304f, -0.605511041f, -0.615231591f,
+	-0.624859488f, -0.634393284f, -0.643831543f, -0.653172843f, -0.662415778f, -0.671558955f,
+	-0.680600998f, -0.689540545f, -0.698376249f, -0.707106781f, -0.715730825f, -0.724247083f,
+	-0.732654272f, -0.740951125f, -0.749136395f, -0.757208847f, -0.765167266f, -0.773010453f,
+	-0.780737229f, -0.788346428f, -0.795836905f, -0.803207531f, -0.810457198f, -0.817584813f,
+	-0.824589303f, -0.831469612f, -0.838224706f, -0.844853565f, -0.851355193f, -0.85772861f,
+	-0.863972856f, -0.870086991f, -0.876070094f, -0.881921264f, -0.88763962f, -0.893224301f,
+	-0.898674466f, -0.903989293f, -0.909167983f, -0.914209756f, -0.919113852f, -0.923879533f,
+	-0.92850608f, -0.932992799f, -0.937339012f, -0.941544065f, -0.945607325f, -0.949528181f,
+	-0.95330604f, -0.956940336f, -0.960430519f, -0.963776066f, -0.966976471f, -0.970031253f,
+	-0.972939952f, -0.97570213f, -0.978317371f, -0.98078528f, -0.983105487f, -0.985277642f,
+	-0.987301418f, -0.98917651f, -0.990902635f, -0.992479535f, -0.99390697f, -0.995184727f,
+	-0.996312612f, -0.997290457f, -0.998118113f, -0.998795456f, -0.999322385f, -0.999698819f,
+	-0.999924702f,
+};
+
+const float fft_twiddle_im[511] = {
+	0.0f, 0.0f, -1.0f, 0.0f, -0.707106781f, -1.0f,
+	-0.707106781f, 0.0f, -0.382683432f, -0.707106781f, -0.923879533f, -1.0f,
+	-0.923879533f, -0.707106781f, -0.382683432f, 0.0f, -0.195090322f, -0.382683432f,
+	-0.555570233f, -0.707106781f, -0.831469612f, -0.923879533f, -0.98078528f, -1.0f,
+	-0.98078528f, -0.923879533f, -0.831469612f, -0.707106781f, -0.555570233f, -0.382683432f,
+	-0.195090322f, 0.0f, -0.0980171403f, -0.195090322f, -0.290284677f, -0.382683432f,
+	-0.471396737f, -0.555570233f, -0.634393284f, -0.707106781f, -0.773010453f, -0.831469612f,
+	-0.881921264f, -0.923879533f, -0.956940336f, -0.98078528f, -0.995184727f, -1.0f,
+	-0.995184727f, -0.98078528f, -0.956940336f, -0.923879533f, -0.881921264f, -0.831469612f,
+	-0.773010453f, -0.707106781f, -0.634393284f, -0.555570233f, -0.471396737f, -0.382683432f,
+	-0.290284677f, -0.195090322f, -0.0980171403f, 0.0f, -0.0490676743f, -0.0980171403f,
+	-0.146730474f, -0.195090322f, -0.24298018f, -0.290284677f, -0.336889853f, -0.382683432f,
+	-0.427555093f, -0.471396737f, -0.514102744f, -0.555570233f, -0.595699304f, -0.634393284f,
+	-0.671558955f, -0.707106781f, -0.740951125f, -0.773010453f, -0.803207531f, -0.831469612f,
+	-0.85772861f, -0.881921264f, -0.903989293f, -0.923879533f, -0.941544065f, -0.956940336f,
+	-0.970031253f, -0.98078528f, -0.98917651f, -0.995184727f, -0.998795456f, -1.0f,
+	-0.998795456f, -0.995184727f, -0.98917651f, -0.98078528f, -0.970031253f, -0.956940336f,
+	-0.941544065f, -0.923879533f, -0.903989293f, -0.881921264f, -0.85772861f, -0.831469612f,
+	-0.803207531f, -0.773010453f, -0.740951125f, -0.707106781f, -0.671558955f, -0.634393284f,
+	-0.595699304f, -0.555570233f, -0.514102744f, -0.471396737f, -0.427555093f, -0.382683432f,
+	-0.336889853f, -0.290284677f, -0.24298018f, -0.195090322f, -0.146730474f, -0.0980171403f,
+	-0.0490676743f, 0.0f, -0.0245412285f, -0.0490676743f, -0.0735645636f, -0.0980171403f,
+	-0.122410675f, -0.146730474f, -0.170961889f, -0.195090322f, -0.21910124f, -0.24298018f,
+	-0.266712757f, -0.290284677f, -0.31368174f, -0.336889853f, -0.359895037f, -0.382683432f,
+	-0.405241314f, -0.427555093f, -0.44961133f, -0.471396737f, -0.492898192f, -0.514102744f,
+	-0.53499762f, -0.555570233f, -0.575808191f, -0.595699304f, -0.615231591f, -0.634393284f,
+	-0.653172843f, -0.671558955f, -0.689540545f, -0.707106781f, -0.724247083f, -0.740951125f,
+	-0.757208847f, -0.773010453f, -0.788346428f, -0.803207531f, -0.817584813f, -0.831469612f,
+	-0.844853565f, -0.85772861f, -0.870086991f, -0.881921264f, -0.893224301f, -0.903989293f,
+	-0.914209756f, -0.923879533f, -0.932992799f, -0.941544065f, -0.949528181f, -0.956940336f,
+	-0.963776066f, -0.970031253f, -0.97570213f, -0.98078528f, -0.985277642f, -0.98917651f,
+	-0.992479535f, -0.995184727f, -0.997290457f, -0.998795456f, -0.999698819f, -1.0f,
+	-0.999698819f, -0.998795456f, -0.997290457f, -0.995184727f, -0.992479535f, -0.98917651f,
+	-0.985277642f, -0.98078528f, -0.97570213f, -0.970031253f, -0.963776066f, -0.956940336f,
+	-0.949528181f, -0.941544065f, -0.932992799f, -0.923879533f, -0.914209756f, -0.903989293f,
+	-0.893224301f, -0.881921264f, -0.870086991f, -0.85772861f, -0.844853565f, -0.831469612f,
+	-0.817584813f, -0.803207531f, -0.788346428f, -0.773010453f, -0.757208847f, -0.740951125f,
+	-0.724247083f, -0.707106781f, -0.689540545f, -0.671558955f, -0.653172843f, -0.634393284f,
+	-0.615231591f, -0.595699304f, -0.575808191f, -0.555570233f, -0.53499762f, -0.514102744f,
+	-0.492898192f, -0.471396737f, -0.44961133f, -0.427555093f, -0.405241314f, -0.382683432f,
+	-0.359895037f, -0.336889853f, -0.31368174f, -0.290284677f, -0.266712757f, -0.24298018f,
+	-0.21910124f, -0.195090322f, -0.170961889f, -0.146730474f, -0.122410675f, -0.0980171403f,
+	-0.0735645636f, -0.0490676743f, -0.0245412285f, 0.0f, -0.0122715383f, -0.0245412285f,
+	-0.0368072229f, -0.0490676743f, -0.0613207363f, -0.0735645636f, -0.0857973123f, -0.0980171403f,
+	-0.110222207f, -0.122410675f, -0.134580709f, -0.146730474f, -0.158858143f, -0.170961889f,
+	-0.183039888f, -0.195090322f, -0.207111376f, -0.21910124f, -0.231058108f, -0.24298018f,
+	-0.25486566f, -0.266712757f, -0.278519689f, -0.290284677f, -0.302005949f, -0.31368174f,
+	-0.325310292f, -0.336889853f, -0.34841868f, -0.359895037f, -0.371317194f, -0.382683432f,
+	-0.39399204f, -0.405241314f, -0.41642956f, -0.427555093f, -0.438616239f, -0.44961133f,
+	-0.460538711f, -0.471396737f, -0.482183772f, -0.492898192f, -0.503538384f, -0.514102744f,
+	-0.524589683f, -0.53499762f, -0.545324988f, -0.555570233f, -0.565731811f, -0.575808191f,
+	-0.585797857f, -0.595699304f, -0.605511041f, -0.615231591f, -0.624859488f, -0.634393284f,
+	-0.643831543f, -0.653172843f, -0.662415778f, -0.671558955f, -0.680600998f, -0.689540545f,
+	-0.698376249f, -0.707106781f, -0.715730825f, -0.724247083f, -0.732654272f, -0.740951125f,
+	-0.749136395f, -0.757208847f, -0.765167266f, -0.773010453f, -0.780737229f, -0.788346428f,
+	-0.795836905f, -0.803207531f, -0.810457198f, -0.817584813f, -0.824589303f, -0.831469612f,
+	-0.838224706f, -0.844853565f, -0.851355193f, -0.85772861f, -0.863972856f, -0.870086991f,
+	-0.876070094f, -0.881921264f, -0.88763962f, -0.893224301f, -0.898674466f, -0.903989293f,
+	-0.909167983f, -0.914209756f, -0.919113852f, -0.923879533f, -0.92850608f, -0.932992799f,
+	-0.937339012f, -0.941544065f, -0.945607325f, -0.949528181f, -0.95330604f, -0.956940336f,
+	-0.960430519f, -0.963776066f, -0.966976471f, -0.970031253f, -0.972939952f, -0.97570213f,
+	-0.978317371f, -0.98078528f, -0.983105487f, -0.985277642f, -0.987301418f, -0.98917651f,
+	-0.990902635f, -0.992479535f, -0.99390697f, -0.995184727f, -0.996312612f, -0.997290457f,
+	-0.998118113f, -0.998795456f, -0.999322385f, -0.999698819f, -0.999924702f, -1.0f,
+	-0.999924702f, -0.999698819f, -0.999322385f, -0.998795456f, -0.998118113f, -0.997290457f,
+	-0.996312612f, -0.995184727f, -0.99390697f, -0.992479535f, -0.990902635f, -0.98917651f,
+	-0.987301418f, -0.985277642f, -0.983105487f, -0.98078528f, -0.978317371f, -0.97570213f,
+	-0.972939952f, -0.970031253f, -0.966976471f, -0.963776066f, -0.960430519f, -0.956940336f,
+	-0.95330604f, -0.949528181f, -0.945607325f, -0.941544065f, -0.937339012f, -0.932992799f,
+	-0.92850608f, -0.923879533f, -0.919113852f, -0.914209756f, -0.909167983f, -0.903989293f,
+	-0.898674466f, -0.893224301f, -0.88763962f, -0.881921264f, -0.876070094f, -0.870086991f,
+	-0.863972856f, -0.85772861f, -0.851355193f, -0.844853565f, -0.838224706f, -0.831469612f,
+	-0.824589303f, -0.817584813f, -0.810457198f, -0.803207531f, -0.795836905f, -0.788346428f,
+	-0.780737229f, -0.773010453f, -0.765167266f, -0.757208847f, -0.749136395f, -0.740951125f,
+	-0.732654272f, -0.724247083f, -0.715730825f, -0.707106781f, -0.698376249f, -0.689540545f,
+	-0.680600998f, -0.671558955f, -0.662415778f, -0.653172843f, -0.643831543f, -0.634393284f,
+	-0.624859488f, -0.615231591f, -0.605511041f, -0.595699304f, -0.585797857f, -0.575808191f,
+	-0.565731811f, -0.555570233f, -0.545324988f, -0.53499762f, -0.524589683f, -0.514102744f,
+	-0.503538384f, -0.492898192f, -0.482183772f, -0.471396737f, -0.460538711f, -0.44961133f,
+	-0.438616239f, -0.427555093f, -0.41642956f, -0.405241314f, -0.39399204f, -0.382683432f,
+	-0.371317194f, -0.359895037f, -0.34841868f, -0.336889853f, -0.325310292f, -0.31368174f,
+	-0.302005949f, -0.290284677f, -0.278519689f, -0.266712757f, -0.25486566f, -0.24298018f,
+	-0.231058108f, -0.21910124f, -0.207111376f, -0.195090322f, -0.183039888f, -0.170961889f,
+	-0.158858143f, -0.146730474f, -0.134580709f, -0.122410675f, -0.110222207f, -0.0980171403f,
+	-0.0857973123f, -0.0735645636f, -0.0613207363f, -0.0490676743f, -0.0368072229f, -0.0245412285f,
+	-0.0122715383f,
+};
+
+const int16_t fft_twiddle_re_q15[511] = {
+	 32767,  32767,      0,  32767,  23170,      0, -23170,  32767,  30273,  23170,
+	 12539,      0, -12539, -23170, -30273,  32767,  32137,  30273,  27245,  23170,
+	 18204,  12539,   6393,      0,  -6393, -12539, -18204, -23170, -27245, -30273,
+	-32137,  32767,  32609,  32137,  31356,  30273,  28898,  27245,  25329,  23170,
+	 20787,  18204,  15446,  12539,   9512,   6393,   3212,      0,  -3212,  -6393,
+	 -9512, -12539, -15446, -18204, -20787, -23170, -25329, -27245, -28898, -30273,
+	-31356, -32137, -32609,  32767,  32728,  32609,  32412,  32137,  31785,  31356,
+	 30852,  30273,  29621,  28898,  28105,  27245,  26319,  25329,  24279,  23170,
+	 22005,  20787,  19519,  18204,  16846,  15446,  14010,  12539,  11039,   9512,
+	  7962,   6393,   4808,   3212,   1608,      0,  -1608,  -3212,  -4808,  -6393,
+	 -7962,  -9512, -11039, -12539, -14010, -15446, -16846, -18204, -19519, -20787,
+	-22005, -23170, -24279, -25329, -26319, -27245, -28105, -28898, -29621, -30273,
+	-30852, -31356, -31785, -32137, -32412, -32609, -32728,  32767,  32757,  32728,
+	 32678,  32609,  32521,  32412,  32285,  32137,  31971,  31785,  31580,  31356,
+	 31113,  30852,  30571,  30273,  29956,  29621,  29268,  28898,  28510,  28105,
+	 27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,  23170,
+	 22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,
+	 16151,  15446,  14732,  14010,  13279,  12539,  11793,  11039,  10278,   9512,
+	  8739,   7962,   7179,   6393,   5602,   4808,   4011,   3212,   2410,   1608,
+	   804,      0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,  -6393,
+	 -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793, -12539, -13279, -14010,
+	-14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787,
+	-21403, -22005, -22594, -23170, -23731, -24279, -24811, -25329, -25832, -26319,
+	-26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956, -30273,
+	-30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412,
+	-32521, -32609, -32678, -32728, -32757,  32767,  32765,  32757,  32745,  32728,
+	 32705,  32678,  32646,  32609,  32567,  32521,  32469,  32412,  32351,  32285,
+	 32213,  32137,  32057,  31971,  31880,  31785,  31685,  31580,  31470,  31356,
+	 31237,  31113,  30985,  30852,  30714,  30571,  30424,  30273,  30117,  29956,
+	 29791,  29621,  29447,  29268,  29085,  28898,  28706,  28510,  28310,  28105,
+	 27896,  27683,  27466,  27245,  27019,  26790,  26556,  26319,  26077,  25832,
+	 25582,  25329,  25072,  24811,  24547,  24279,  24007,  23731,  23452,  23170,
+	 22884,  22594,  22301,  22005,  21705,  21403,  21096,  20787,  20475,  20159,
+	 19841,  19519,  19195,  18868,  18537,  18204,  17869,  17530,  17189,  16846,
+	 16499,  16151,  15800,  15446,  15090,  14732,  14372,  14010,  13645,  13279,
+	 12910,  12539,  12167,  11793,  11417,  11039,  10659,  10278,   9896,   9512,
+	  9126,   8739,   8351,   7962,   7571,   7179,   6786,   6393,   5998,   5602,
+	  5205,   4808,   4410,   4011,   3612,   3212,   2811,   2410,   2009,   1608,
+	  1206,    804,    402,      0,   -402,   -804,  -1206,  -1608,  -2009,  -2410,
+	 -2811,  -3212,  -3612,  -4011,  -4410,  -4808,  -5205,  -5602,  -5998,  -6393,
+	 -6786,  -7179,  -7571,  -7962,  -8351,  -8739,  -9126,  -9512,  -9896, -10278,
+	-10659, -11039, -11417, -11793, -12167, -12539, -12910, -13279, -13645, -14010,
+	-14372, -14732, -15090, -15446, -15800, -16151, -16499, -16846, -17189, -17530,
+	-17869, -18204, -18537, -18868, -19195, -19519, -19841, -20159, -20475, -20787,
+	-21096, -21403, -21705, -22005, -22301, -22594, -22884, -23170, -23452, -23731,
+	-24007, -24279, -24547, -24811, -25072, -25329, -25582, -25832, -26077, -26319,
+	-26556, -26790, -27019, -27245, -27466, -27683, -27896, -28105, -28310, -28510,
+	-28706, -28898, -29085, -29268, -29447, -29621, -29791, -29956, -30117, -30273,
+	-30424, -30571, -30714, -30852, -30985, -31113, -31237, -31356, -31470, -31580,
+	-31685, -31785, -31880, -31971, -32057, -32137, -32213, -32285, -32351, -32412,
+	-32469, -32521, -32567, -32609, -32646, -32678, -32705, -32728, -32745, -32757,
+	-32765,
+};
+
+const int16_t fft_twiddle_im_q15[511] = {
+	     0,      0, -32767,      0, -23170, -32767, -23170,      0, -12539, -23170,
+	-30273, -32767, -30273, -23170, -12539,      0,  -6393, -12539, -18204, -23170,
+	-27245, -30273, -32137, -32767, -32137, -30273, -27245, -23170, -18204, -12539,
+	 -6393,      0,  -3212,  -6393,  -9512, -12539, -15446, -18204, -20787, -23170,
+	-25329, -27245, -28898, -30273, -31356, -32137, -32609, -32767, -32609, -32137,
+	-31356, -30273, -28898, -27245, -25329, -23170, -20787, -18204, -15446, -12539,
+	 -9512,  -6393,  -3212,      0,  -1608,  -3212,  -4808,  -6393,  -7962,  -9512,
+	-11039, -12539, -14010, -15446, -16846, -18204, -19519, -20787, -22005, -23170,
+	-24279, -25329, -26319, -27245, -28105, -28898, -29621, -30273, -30852, -31356,
+	-31785, -32137, -32412, -32609, -32728, -32767, -32728, -32609, -32412, -32137,
+	-31785, -31356, -30852, -30273, -29621, -28898, -28105, -27245, -26319, -25329,
+	-24279, -23170, -22005, -20787, -19519, -18204, -16846, -15446, -14010, -12539,
+	-11039,  -9512,  -7962,  -6393,  -4808,  -3212,  -1608,      0,   -804,  -1608,
+	 -2410,  -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512,
+	-10278, -11039, -11793, -12539, -13279, -14010, -14732, -15446, -16151, -16846,
+	-17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594, -23170,
+	-23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105,
+	-28510, -28898, -29268, -29621, -29956, -30273, -30571, -30852, -31113, -31356,
+	-31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728,
+	-32757, -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137,
+	-31971, -31785, -31580, -31356, -31113, -30852, -30571, -30273, -29956, -29621,
+	-29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329,
+	-24811, -24279, -23731, -23170, -22594, -22005, -21403, -20787, -20159, -19519,
+	-18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279, -12539,
+	-11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,
+	 -4011,  -3212,  -2410,  -1608,   -804,      0,   -402,   -804,  -1206,  -1608,
+	 -2009,  -2410,  -2811,  -3212,  -3612,  -4011,  -4410,  -4808,  -5205,  -5602,
+	 -5998,  -6393,  -6786,  -7179,  -7571,  -7962,  -8351,  -8739,  -9126,  -9512,
+	 -9896, -10278, -10659, -11039, -11417, -11793, -12167, -12539, -12910, -13279,
+	-13645, -14010, -14372, -14732, -15090, -15446, -15800, -16151, -16499, -16846,
+	-17189, -17530, -17869, -18204, -18537, -18868, -19195, -19519, -19841, -20159,
+	-20475, -20787, -21096, -21403, -21705, -22005, -22301, -22594, -22884, -23170,
+	-23452, -23731, -24007, -24279, -24547, -24811, -25072, -25329, -25582, -25832,
+	-26077, -26319, -26556, -26790, -27019, -27245, -27466, -27683, -27896, -28105,
+	-28310, -28510, -28706, -28898, -29085, -29268, -29447, -29621, -29791, -29956,
+	-30117, -30273, -30424, -30571, -30714, -30852, -30985, -31113, -31237, -31356,
+	-31470, -31580, -31685, -31785, -31880, -31971, -32057, -32137, -32213, -32285,
+	-32351, -32412, -32469, -32521, -32567, -32609, -32646, -32678, -32705, -32728,
+	-32745, -32757, -32765, -32767, -32765, -32757, -32745, -32728, -32705, -32678,
+	-32646, -32609, -32567, -32521, -32469, -32412, -32351, -32285, -32213, -32137,
+	-32057, -31971, -31880, -31785, -31685, -31580, -31470, -31356, -31237, -31113,
+	-30985, -30852, -30714, -30571, -30424, -30273, -30117, -29956, -29791, -29621,
+	-29447, -29268, -29085, -28898, -28706, -28510, -28310, -28105, -27896, -27683,
+	-27466, -27245, -27019, -26790, -26556, -26319, -26077, -25832, -25582, -25329,
+	-25072, -24811, -24547, -24279, -24007, -23731, -23452, -23170, -22884, -22594,
+	-22301, -22005, -21705, -21403, -21096, -20787, -20475, -20159, -19841, -19519,
+	-19195, -18868, -18537, -18204, -17869, -17530, -17189, -16846, -16499, -16151,
+	-15800, -15446, -15090, -14732, -14372, -14010, -13645, -13279, -12910, -12539,
+	-12167, -11793, -11417, -11039, -10659, -10278,  -9896,  -9512,  -9126,  -8739,
+	 -8351,  -7962,  -7571,  -7179,  -6786,  -6393,  -5998,  -5602,  -5205,  -4808,
+	 -4410,  -4011,  -3612,  -3212,  -2811,  -2410,  -2009,  -1608,  -1206,   -804,
+	  -402,
+};
+
+const float fft_hann[512] = {
+	0.0f, 3.77965773e-05f, 0.000151180595f, 0.00034013491f, 0.000604630957f, 0.000944628746f,
+	0.00136007687f, 0.00185091253f, 0.00241706151f, 0.00305843822f, 0.00377494569f, 0.00456647559f,
+	0.00543290826f, 0.0063741127f, 0.00738994662f, 0.00848025644f, 0.00964487731f, 0.0108836332f,
+	0.0121963367f, 0.0135827895f, 0.0150427819f, 0.0165760932f, 0.0181824916f, 0.0198617342f,
+	0.0216135671f, 0.0234377255f, 0.0253339336f, 0.0273019047f, 0.0293413412f, 0.031451935f,
+	0.0336333667f, 0.0358853068f, 0.0382074146f, 0.0405993391f, 0.0430607187f, 0.0455911813f,
+	0.0481903443f, 0.0508578147f, 0.0535931893f, 0.0563960544f, 0.0592659864f, 0.0622025514f,
+	0.0652053053f, 0.0682737943f, 0.0714075543f, 0.0746061116f, 0.0778689827f, 0.0811956742f,
+	0.0845856832f, 0.0880384971f, 0.091553594f, 0.0951304424f, 0.0987685015f, 0.102467221f,
+	0.106226043f, 0.110044397f, 0.113921708f, 0.117857388f, 0.121850843f, 0.125901469f,
+	0.130008654f, 0.134171776f, 0.138390206f, 0.142663307f, 0.146990432f, 0.151370928f,
+	0.155804131f, 0.160289372f, 0.164825973f, 0.169413247f, 0.174050502f, 0.178737036f,
+	0.18347214f, 0.188255099f, 0.19308519f, 0.197961681f, 0.202883837f, 0.207850913f,
+	0.212862158f, 0.217916814f, 0.223014117f, 0.228153297f, 0.233333576f, 0.238554171f,
+	0.243814294f, 0.249113148f, 0.254449933f, 0.259823842f, 0.265234062f, 0.270679775f,
+	0.276160159f, 0.281674384f, 0.287221617f, 0.292801019f, 0.298411747f, 0.304052952f,
+	0.309723782f, 0.315423378f, 0.321150881f, 0.326905422f, 0.332686134f, 0.338492141f,
+	0.344322565f, 0.350176526f, 0.356053138f, 0.361951513f, 0.36787076f, 0.373809982f,
+	0.379768282f, 0.38574476f, 0.391738511f, 0.397748631f, 0.403774209f, 0.409814335f,
+	0.415868096f, 0.421934577f, 0.42801286f, 0.434102027f, 0.440201156f, 0.446309327f,
+	0.452425614f, 0.458549094f, 0.464678841f, 0.470813928f, 0.476953428f, 0.483096412f,
+	0.489241951f, 0.495389117f, 0.50153698f, 0.507684611f, 0.51383108f, 0.519975458f,
+	0.526116815f, 0.532254225f, 0.538386758f, 0.544513487f, 0.550633486f, 0.556745831f,
+	0.562849596f, 0.568943859f, 0.575027699f, 0.581100196f, 0.587160431f, 0.593207489f,
+	0.599240456f, 0.605258418f, 0.611260467f, 0.617245695f, 0.623213197f, 0.62916207f,
+	0.635091417f, 0.641000339f, 0.646887944f, 0.652753341f, 0.658595644f, 0.66441397f,
+	0.670207439f, 0.675975174f, 0.681716305f, 0.687429962f, 0.693115283f, 0.698771407f,
+	0.70439748f, 0.709992651f, 0.715556073f, 0.721086907f, 0.726584315f, 0.732047467f,
+	0.737475536f, 0.742867702f, 0.74822315f, 0.75354107f, 0.758820659f, 0.764061117f,
+	0.769261652f, 0.774421479f, 0.779539817f, 0.784615893f, 0.789648938f, 0.794638193f,
+	0.799582902f, 0.804482319f, 0.809335702f, 0.814142317f, 0.818901439f, 0.823612347f,
+	0.828274329f, 0.832886681f, 0.837448705f, 0.841959711f, 0.846419017f, 0.85082595f,
+	0.855179843f, 0.859480037f, 0.863725883f, 0.867916738f, 0.87205197f, 0.876130952f,
+	0.880153069f, 0.884117711f, 0.888024281f, 0.891872186f, 0.895660845f, 0.899389686f,
+	0.903058145f, 0.906665667f, 0.910211707f, 0.913695728f, 0.917117204f, 0.920475618f,
+	0.923770461f, 0.927001237f, 0.930167455f, 0.933268638f, 0.936304317f, 0.939274033f,
+	0.942177336f, 0.945013788f, 0.94778296f, 0.950484434f, 0.9531178f, 0.955682662f,
+	0.95817863f, 0.960605328f, 0.962962389f, 0.965249456f, 0.967466184f, 0.969612237f,
+	0.971687291f, 0.973691033f, 0.975623159f, 0.977483377f, 0.979271407f, 0.980986977f,
+	0.982629829f, 0.984199713f, 0.985696393f, 0.987119643f, 0.988469246f, 0.989745f,
+	0.990946711f, 0.992074198f, 0.99312729f, 0.994105827f, 0.995009663f, 0.99583866f,
+	0.996592693f, 0.997271648f, 0.997875422f, 0.998403924f, 0.998857075f, 0.999234805f,
+	0.999537058f, 0.999763787f, 0.999914959f, 0.999990551f, 0.999990551f, 0.999914959f,
+	0.999763787f, 0.999537058f, 0.999234805f, 0.998857075f, 0.998403924f, 0.997875422f,
+	0.997271648f, 0.996592693f, 0.99583866f, 0.995009663f, 0.994105827f, 0.99312729f,
+	0.992074198f, 0.990946711f, 0.989745f, 0.988469246f, 0.987119643f, 0.985696393f,
+	0.984199713f, 0.982629829f, 0.980986977f, 0.979271407f, 0.977483377f, 0.975623159f,
+	0.973691033f, 0.971687291f, 0.969612237f, 0.967466184f, 0.965249456f, 0.962962389f,
+	0.960605328f, 0.95817863f, 0.955682662f, 0.9531178f, 0.950484434f, 0.94778296f,
+	0.945013788f, 0.942177336f, 0.939274033f, 0.936304317f, 0.933268638f, 0.930167455f,
+	0.927001237f, 0.923770461f, 0.920475618f, 0.917117204f, 0.913695728f, 0.910211707f,
+	0.906665667f, 0.903058145f, 0.899389686f, 0.895660845f, 0.891872186f, 0.888024281f,
+	0.884117711f, 0.880153069f, 0.876130952f, 0.87205197f, 0.867916738f, 0.863725883f,
+	0.859480037f, 0.855179843f, 0.85082595f, 0.846419017f, 0.841959711f, 0.837448705f,
+	0.832886681f, 0.828274329f, 0.823612347f, 0.818901439f, 0.814142317f, 0.809335702f,
+	0.804482319f, 0.799582902f, 0.794638193f, 0.789648938f, 0.784615893f, 0.779539817f,
+	0.774421479f, 0.769261652f, 0.764061117f, 0.758820659f, 0.75354107f, 0.74822315f,
+	0.742867702f, 0.737475536f, 0.732047467f, 0.726584315f, 0.721086907f, 0.715556073f,
+	0.709992651f, 0.70439748f, 0.698771407f, 0.693115283f, 0.687429962f, 0.681716305f,
+	0.675975174f, 0.670207439f, 0.66441397f, 0.658595644f, 0.652753341f, 0.646887944f,
+	0.641000339f, 0.635091417f, 0.62916207f, 0.623213197f, 0.617245695f, 0.611260467f,
+	0.605258418f, 0.599240456f, 0.593207489f, 0.587160431f, 0.581100196f, 0.575027699f,
+	0.568943859f, 0.562849596f, 0.556745831f, 0.550633486f, 0.544513487f, 0.538386758f,
+	0.532254225f, 0.526116815f, 0.519975458f, 0.51383108f, 0.507684611f, 0.50153698f,
+	0.495389117f, 0.489241951f, 0.483096412f, 0.476953428f, 0.470813928f, 0.464678841f,
+	0.458549094f, 0.452425614f, 0.446309327f, 0.440201156f, 0.434102027f, 0.42801286f,
+	0.421934577f, 0.415868096f, 0.409814335f, 0.403774209f, 0.397748631f, 0.391738511f,
+	0.38574476f, 0.379768282f, 0.373809982f, 0.36787076f, 0.361951513f, 0.356053138f,
+	0.350176526f, 0.344322565f, 0.338492141f, 0.332686134f, 0.326905422f, 0.321150881f,
+	0.315423378f, 0.309723782f, 0.304052952f, 0.298411747f, 0.292801019f, 0.287221617f,
+	0.281674384f, 0.276160159f, 0.270679775f, 0.265234062f, 0.259823842f, 0.254449933f,
+	0.249113148f, 0.243814294f, 0.238554171f, 0.233333576f, 0.228153297f, 0.223014117f,
+	0.217916814f, 0.212862158f, 0.207850913f, 0.202883837f, 0.197961681f, 0.19308519f,
+	0.188255099f, 0.18347214f, 0.178737036f, 0.174050502f, 0.169413247f, 0.164825973f,
+	0.160289372f, 0.155804131f, 0.151370928f, 0.146990432f, 0.142663307f, 0.138390206f,
+	0.134171776f, 0.130008654f, 0.125901469f, 0.121850843f, 0.117857388f, 0.113921708f,
+	0.110044397f, 0.106226043f, 0.102467221f, 0.0987685015f, 0.0951304424f, 0.091553594f,
+	0.0880384971f, 0.0845856832f, 0.0811956742f, 0.0778689827f, 0.0746061116f, 0.0714075543f,
+	0.0682737943f, 0.0652053053f, 0.0622025514f, 0.0592659864f, 0.0563960544f, 0.0535931893f,
+	0.0508578147f, 0.0481903443f, 0.0455911813f, 0.0430607187f, 0.0405993391f, 0.0382074146f,
+	0.0358853068f, 0.0336333667f, 0.031451935f, 0.0293413412f, 0.0273019047f, 0.0253339336f,
+	0.0234377255f, 0.0216135671f, 0.0198617342f, 0.0181824916f, 0.0165760932f, 0.0150427819f,
+	0.0135827895f, 0.0121963367f, 0.0108836332f, 0.00964487731f, 0.00848025644f, 0.00738994662f,
+	0.0063741127f, 0.00543290826f, 0.00456647559f, 0.00377494569f, 0.00305843822f, 0.00241706151f,
+	0.00185091253f, 0.00136007687f, 0.000944628746f, 0.000604630957f, 0.00034013491f, 0.000151180595f,
+	3.77965773e-05f, 0.0f,
+};
+
+const int16_t fft_hann_q15[512] = {
+	     0,      1,      5,     11,     20,     31,     45,     61,     79,    100,
+	   124,    150,    178,    209,    242,    278,    316,    357,    400,    445,
+	   493,    543,    596,    651,    708,    768,    830,    895,    961,   1031,
+	  1102,   1176,   1252,   1330,   1411,   1494,   1579,   1666,   1756,   1848,
+	  1942,   2038,   2137,   2237,   2340,   2445,   2552,   2661,   2772,   2885,
+	  3000,   3117,   3236,   3358,   3481,   3606,   3733,   3862,   3993,   4125,
+	  4260,   4396,   4535,   4675,   4816,   4960,   5105,   5252,   5401,   5551,
+	  5703,   5857,   6012,   6169,   6327,   6487,   6648,   6811,   6975,   7140,
+	  7308,   7476,   7646,   7817,   7989,   8163,   8338,   8514,   8691,   8869,
+	  9049,   9230,   9411,   9594,   9778,   9963,  10149,  10335,  10523,  10712,
+	 10901,  11091,  11282,  11474,  11667,  11860,  12054,  12249,  12444,  12640,
+	 12836,  13033,  13230,  13428,  13627,  13826,  14025,  14224,  14424,  14624,
+	 14825,  15025,  15226,  15427,  15628,  15830,  16031,  16232,  16434,  16635,
+	 16837,  17038,  17239,  17440,  17641,  17842,  18043,  18243,  18443,  18643,
+	 18842,  19041,  19239,  19438,  19635,  19833,  20029,  20225,  20421,  20616,
+	 20810,  21004,  21197,  21389,  21580,  21771,  21961,  22150,  22338,  22525,
+	 22711,  22897,  23081,  23264,  23447,  23628,  23808,  23987,  24165,  24342,
+	 24517,  24691,  24864,  25036,  25206,  25375,  25543,  25710,  25874,  26038,
+	 26200,  26360,  26520,  26677,  26833,  26987,  27140,  27291,  27441,  27588,
+	 27735,  27879,  28022,  28163,  28302,  28439,  28575,  28708,  28840,  28970,
+	 29098,  29224,  29348,  29470,  29591,  29709,  29825,  29939,  30051,  30161,
+	 30269,  30375,  30479,  30580,  30680,  30777,  30872,  30965,  31056,  31145,
+	 31231,  31315,  31397,  31476,  31553,  31628,  31701,  31771,  31839,  31905,
+	 31968,  32029,  32088,  32144,  32198,  32249,  32298,  32345,  32389,  32431,
+	 32470,  32507,  32542,  32574,  32603,  32631,  32655,  32678,  32697,  32715,
+	 32730,  32742,  32752,  32759,  32764,  32767,  32767,  32764,  32759,  32752,
+	 32742,  32730,  32715,  32697,  32678,  32655,  32631,  32603,  32574,  32542,
+	 32507,  32470,  32431,  32389,  32345,  32298,  32249,  32198,  32144,  32088,
+	 32029,  31968,  31905,  31839,  31771,  31701,  31628,  31553,  31476,  31397,
+	 31315,  31231,  31145,  31056,  30965,  30872,  30777,  30680,  30580,  30479,
+	 30375,  30269,  30161,  30051,  29939,  29825,  29709,  29591,  29470,  29348,
+	 29224,  29098,  28970,  28840,  28708,  28575,  28439,  28302,  28163,  28022,
+	 27879,  27735,  27588,  27441,  27291,  27140,  26987,  26833,  26677,  26520,
+	 26360,  26200,  26038,  25874,  25710,  25543,  25375,  25206,  25036,  24864,
+	 24691,  24517,  24342,  24165,  23987,  23808,  23628,  23447,  23264,  23081,
+	 22897,  22711,  22525,  22338,  22150,  21961,  21771,  21580,  21389,  21197,
+	 21004,  20810,  20616,  20421,  20225,  20029,  19833,  19635,  19438,  19239,
+	 19041,  18842,  18643,  18443,  18243,  18043,  17842,  17641,  17440,  17239,
+	 17038,  16837,  16635,  16434,  16232,  16031,  15830,  15628,  15427,  15226,
+	 15025,  14825,  14624,  14424,  14224,  14025,  13826,  13627,  13428,  13230,
+	 13033,  12836,  12640,  12444,  12249,  12054,  11860,  11667,  11474,  11282,
+	 11091,  10901,  10712,  10523,  10335,  10149,   9963,   9778,   9594,   9411,
+	  9230,   9049,   8869,   8691,   8514,   8338,   8163,   7989,   7817,   7646,
+	  7476,   7308,   7140,   6975,   6811,   6648,   6487,   6327,   6169,   6012,
+	  5857,   5703,   5551,   5401,   5252,   5105,   4960,   4816,   4675,   4535,
+	  4396,   4260,   4125,   3993,   3862,   3733,   3606,   3481,   3358,   3236,
+	  3117,   3000,   2885,   2772,   2661,   2552,   2445,   2340,   2237,   2137,
+	  2038,   1942,   1848,   1756,   1666,   1579,   1494,   1411,   1330,   1252,
+	  1176,   1102,   1031,    961,    895,    830,    768,    708,    651,    596,
+	   543,    493,    445,    400,    357,    316,    278,    242,    209,    178,
+	   150,    124,    100,     79,     61,     45,     31,     20,     11,      5,
+	     1,      0,
+};
+
+const float fft_hann_short[256] = {
+	0.0f, 0.000151774011f, 0.000607003903f, 0.00136541331f, 0.0024265418f, 0.00378974516f,
+	0.00545419581f, 0.00741888327f, 0.00968261477f, 0.012244016f, 0.015101532f, 0.0182534279f,
+	0.0216977902f, 0.025432528f, 0.0294553737f, 0.0337638853f, 0.0383554469f, 0.0432272712f,
+	0.0483764003f, 0.0537997084f, 0.0594939029f, 0.0654555268f, 0.0716809611f, 0.0781664261f,
+	0.0849079846f, 0.0919015438f, 0.099142858f, 0.106627531f, 0.114351019f, 0.122308633f,
+	0.130495541f, 0.138906775f, 0.147537227f, 0.156381657f, 0.165434697f, 0.17469085f,
+	0.184144497f, 0.193789898f, 0.203621199f, 0.21363243f, 0.223817514f, 0.234170266f,
+	0.244684403f, 0.255353542f, 0.266171204f, 0.277130822f, 0.288225744f, 0.299449233f,
+	0.310794475f, 0.322254583f, 0.3338226f, 0.345491503f, 0.357254207f, 0.369103571f,
+	0.381032402f, 0.393033458f, 0.405099453f, 0.417223062f, 0.429396924f, 0.441613649f,
+	0.45386582f, 0.466145999f, 0.478446731f, 0.490760548f, 0.503079973f, 0.515397529f,
+	0.527705737f, 0.539997126f, 0.552264232f, 0.564499608f, 0.576695827f, 0.588845485f,
+	0.600941205f, 0.612975643f, 0.624941495f, 0.636831495f, 0.648638425f, 0.660355118f,
+	0.671974459f, 0.683489396f, 0.694892937f, 0.706178159f, 0.717338211f, 0.728366318f,
+	0.739255785f, 0.75f, 0.760592441f, 0.771026678f, 0.781296376f, 0.791395299f,
+	0.801317318f, 0.811056408f, 0.820606657f, 0.829962267f, 0.839117559f, 0.848066973f,
+	0.856805077f, 0.865326566f, 0.873626267f, 0.881699141f, 0.889540287f, 0.897144945f,
+	0.904508497f, 0.911626474f, 0.918494554f, 0.925108568f, 0.9314645f, 0.937558491f,
+	0.943386843f, 0.948946016f, 0.954232636f, 0.959243493f, 0.963975545f, 0.968425919f,
+	0.972591914f, 0.976471f, 0.980060823f, 0.983359202f, 0.986364136f, 0.9890738f,
+	0.99148655f, 0.99360092f, 0.995415627f, 0.996929568f, 0.998141826f, 0.999051664f,
+	0.99965853f, 0.999962055f, 0.999962055f, 0.99965853f, 0.999051664f, 0.998141826f,
+	0.996929568f, 0.995415627f, 0.99360092f, 0.99148655f, 0.9890738f, 0.986364136f,
+	0.983359202f, 0.980060823f, 0.976471f, 0.972591914f, 0.968425919f, 0.963975545f,
+	0.959243493f, 0.954232636f, 0.948946016f, 0.943386843f, 0.937558491f, 0.9314645f,
+	0.925108568f, 0.918494554f, 0.911626474f, 0.904508497f, 0.897144945f, 0.889540287f,
+	0.881699141f, 0.873626267f, 0.865326566f, 0.856805077f, 0.848066973f, 0.839117559f,
+	0.829962267f, 0.820606657f, 0.811056408f, 0.801317318f, 0.791395299f, 0.781296376f,
+	0.771026678f, 0.760592441f, 0.75f, 0.739255785f, 0.728366318f, 0.717338211f,
+	0.706178159f, 0.694892937f, 0.683489396f, 0.671974459f, 0.660355118f, 0.648638425f,
+	0.636831495f, 0.624941495f, 0.612975643f, 0.600941205f, 0.588845485f, 0.576695827f,
+	0.564499608f, 0.552264232f, 0.539997126f, 0.527705737f, 0.515397529f, 0.503079973f,
+	0.490760548f, 0.478446731f, 0.466145999f, 0.45386582f, 0.441613649f, 0.429396924f,
+	0.417223062f, 0.405099453f, 0.393033458f, 0.381032402f, 0.369103571f, 0.357254207f,
+	0.345491503f, 0.3338226f, 0.322254583f, 0.310794475f, 0.299449233f, 0.288225744f,
+	0.277130822f, 0.266171204f, 0.255353542f, 0.244684403f, 0.234170266f, 0.223817514f,
+	0.21363243f, 0.203621199f, 0.193789898f, 0.184144497f, 0.17469085f, 0.165434697f,
+	0.156381657f, 0.147537227f, 0.138906775f, 0.130495541f, 0.122308633f, 0.114351019f,
+	0.106627531f, 0.099142858f, 0.0919015438f, 0.0849079846f, 0.0781664261f, 0.0716809611f,
+	0.0654555268f, 0.0594939029f, 0.0537997084f, 0.0483764003f, 0.0432272712f, 0.0383554469f,
+	0.0337638853f, 0.0294553737f, 0.025432528f, 0.0216977902f, 0.0182534279f, 0.015101532f,
+	0.012244016f, 0.00968261477f, 0.00741888327f, 0.00545419581f, 0.00378974516f, 0.0024265418f,
+	0.00136541331f, 0.000607003903f, 0.000151774011f, 0.0f,
+};
+
+const float note_ratio_a4[88] = {
+	0.0625f, 0.0662164434f, 0.070153878f, 0.0743254447f, 0.0787450656f, 0.0834274909f,
+	0.0883883476f, 0.0936441923f, 0.0992125657f, 0.105112052f, 0.11136234f, 0.117984289f,
+	0.125f, 0.132432887f, 0.140307756f, 0.148650889f, 0.157490131f, 0.166854982f,
+	0.176776695f, 0.187288385f, 0.198425131f, 0.210224104f, 0.22272468f, 0.235968578f,
+	0.25f, 0.264865774f, 0.280615512f, 0.297301779f, 0.314980262f, 0.333709964f,
+	0.353553391f, 0.374576769f, 0.396850263f, 0.420448208f, 0.445449359f, 0.471937156f,
+	0.5f, 0.529731547f, 0.561231024f, 0.594603558f, 0.629960525f, 0.667419927f,
+	0.707106781f, 0.749153538f, 0.793700526f, 0.840896415f, 0.890898718f, 0.943874313f,
+	1.0f, 1.05946309f, 1.12246205f, 1.18920712f, 1.25992105f, 1.33483985f,
+	1.41421356f, 1.49830708f, 1.58740105f, 1.68179283f, 1.78179744f, 1.88774863f,
+	2.0f, 2.11892619f, 2.2449241f, 2.37841423f, 2.5198421f, 2.66967971f,
+	2.82842712f, 2.99661415f, 3.1748021f, 3.36358566f, 3.56359487f, 3.77549725f,
+	4.0f, 4.23785238f, 4.48984819f, 4.75682846f, 5.0396842f, 5.33935942f,
+	5.65685425f, 5.99322831f, 6.34960421f, 6.72717132f, 7.12718975f, 7.5509945f,
+	8.0f, 8.47570475f, 8.97969639f, 9.51365692f,
+};
+
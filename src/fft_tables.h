@@ -0,0 +1,37 @@
+/*
+Constant tables generated on the host by tools/gen_tables.c (see that file to regenerate src/fft_tables.c).
+All values are computed in double precision, so nothing here depends on the truncated PI or the
+Taylor-series sine()/cosine() in trig.c, and nothing has to be computed at boot.
+
+	fft_twiddle_re/im     - exp(-j*PI*k/2^s) for stage s = 0..FFT_TABLE_M-1, k < 2^s,
+	                        stage s starts at index 2^s - 1
+	fft_twiddle_re/im_q15 - same twiddles in Q15
+	fft_hann              - Hann window 0.5 - 0.5*cos(2*PI*i/(N-1)) for the N = FFT_HANN_N frame
+	fft_hann_q15          - same window in Q15
+	fft_hann_short        - the same window for an N = FFT_HANN_SHORT_N frame (float pipeline only)
+	note_ratio_a4         - 2^((midi - 69)/12) for midi = NOTE_MIDI_LO..NOTE_MIDI_HI,
+	                        multiply by the A4 reference to get the note frequency
+*/
+
+#ifndef FFT_TABLES_H
+#define FFT_TABLES_H
+
+#include <stdint.h>
+
+#define FFT_TABLE_M   9
+#define FFT_TABLE_N   (1 << FFT_TABLE_M)
+#define FFT_HANN_N    512
+#define FFT_HANN_SHORT_N 256
+#define NOTE_MIDI_LO  21     // A0
+#define NOTE_MIDI_HI  108    // C8
+
+extern const float fft_twiddle_re[FFT_TABLE_N - 1];
+extern const float fft_twiddle_im[FFT_TABLE_N - 1];
+extern const int16_t fft_twiddle_re_q15[FFT_TABLE_N - 1];
+extern const int16_t fft_twiddle_im_q15[FFT_TABLE_N - 1];
+extern const float fft_hann[FFT_HANN_N];
+extern const int16_t fft_hann_q15[FFT_HANN_N];
+extern const float fft_hann_short[FFT_HANN_SHORT_N];
+extern const float note_ratio_a4[NOTE_MIDI_HI - NOTE_MIDI_LO + 1];
+
+#endif
@@ -0,0 +1,149 @@
+#include <stdint.h>
+#include <math.h>
+#include "gbank.h"
+
+#define TWO_PI 6.28318531f
+
+
+// last n decimated samples (volts), hist_pos is the oldest
+static float hist[GBANK_MAX_N];
+static int hist_pos = 0;
+static int bank_n = 0;
+
+// windowed history in time order, input of the filters
+static float frame[GBANK_MAX_N];
+
+// DC of the starting frame (see sdft.c, a per-block average would leak into low notes)
+static int32_t frame_dc = 0;
+
+static int active = 0;
+
+
+/* Average of raw_len samples */
+static int32_t raw_dc(const int32_t* raw, int raw_len) {
+	int i;
+	int64_t sum = 0;
+	for (i = 0; i < raw_len; i++) {
+		sum += raw[i];
+	}
+	return (int32_t)(sum / raw_len);
+}
+
+
+/* Starts tracking with the n decimated samples of a full raw frame as history */
+void gbank_start(const int32_t* raw, int raw_len, int decim, int n, float scale) {
+	int i;
+
+	if (n > GBANK_MAX_N) n = GBANK_MAX_N;
+	bank_n = n;
+	hist_pos = 0;
+
+	frame_dc = raw_dc(raw, raw_len);
+	for (i = 0; i < n; i++) {
+		int idx = i * decim;
+		hist[i] = (idx < raw_len) ? (float)(raw[idx] - frame_dc) * scale : 0.0f;
+	}
+	active = 1;
+}
+
+
+/* Slides one raw block into the history (DC from gbank_start) */
+void gbank_push(const int32_t* raw, int raw_len, int decim, float scale) {
+	int i;
+
+	if (!active) return;
+
+	for (i = 0; i < raw_len; i += decim) {
+		hist[hist_pos] = (float)(raw[i] - frame_dc) * scale;
+		hist_pos++;
+		if (hist_pos == bank_n) hist_pos = 0;
+	}
+}
+
+
+/* Squared magnitudes of the windowed frame at GBANK_BINS frequencies (w radians per sample), Goertzel;
+   all filters advance together, so their recursions are independent of each other within a sample */
+static void goertzel_bank(const float* w, float* mag2) {
+	int i, k;
+	float coeff[GBANK_BINS];
+	float s1[GBANK_BINS];
+	float s2[GBANK_BINS];
+
+	for (k = 0; k < GBANK_BINS; k++) {
+		coeff[k] = 2.0f * cosf(w[k]);
+		s1[k] = 0.0f;
+		s2[k] = 0.0f;
+	}
+	for (i = 0; i < bank_n; i++) {
+		float x = frame[i];
+		for (k = 0; k < GBANK_BINS; k++) {
+			float s = x + coeff[k] * s1[k] - s2[k];
+			s2[k] = s1[k];
+			s1[k] = s;
+		}
+	}
+	for (k = 0; k < GBANK_BINS; k++) {
+		mag2[k] = s1[k] * s1[k] + s2[k] * s2[k] - coeff[k] * s1[k] * s2[k];
+	}
+}
+
+
+/* Strongest of GBANK_BINS filters step_cents apart around f_center, refined by a parabola */
+float gbank_peak(const float* window, float sample_f, float f_center, float step_cents, float* peak_mag, int* edge) {
+	int i, k;
+	int pos = hist_pos;
+	float w[GBANK_BINS];
+	float mag[GBANK_BINS];
+	int place = 0;
+
+	*peak_mag = 0.0f;
+	*edge = 1;
+	if (!active || f_center <= 0.0f) return 0.0f;
+
+	for (i = 0; i < bank_n; i++) {
+		frame[i] = hist[pos] * window[i];
+		pos++;
+		if (pos == bank_n) pos = 0;
+	}
+
+	// filter k sits at f_center * 2^((k - center) * step / 1200): the bank is symmetric in cents
+	float center = 0.5f * (float)(GBANK_BINS - 1);
+	float ratio = powf(2.0f, step_cents / 1200.0f);
+	float f = f_center * powf(ratio, -center);
+	for (k = 0; k < GBANK_BINS; k++) {
+		w[k] = TWO_PI * f / sample_f;
+		f *= ratio;
+	}
+	goertzel_bank(w, mag);
+	for (k = 1; k < GBANK_BINS; k++) {
+		if (mag[k] > mag[place]) place = k;
+	}
+
+	*peak_mag = mag[place];
+	*edge = (place == 0 || place == GBANK_BINS - 1);
+	if (mag[place] <= 0.0f) return 0.0f;
+
+	float delta = 0.0f;
+	if (!*edge) {
+		// on the magnitudes: the main lobe is close to a parabola over a few cents
+		float y1 = sqrtf(mag[place - 1]);
+		float y2 = sqrtf(mag[place]);
+		float y3 = sqrtf(mag[place + 1]);
+		float denom = y1 - 2.0f * y2 + y3;
+		if (denom != 0.0f) delta = 0.5f * (y1 - y3) / denom;
+	}
+
+	return f_center * powf(ratio, (float)place + delta - center);
+}
+
+
+/* Leaves tracking */
+void gbank_stop(void) {
+	active = 0;
+}
+
+
+/* Getter */
+int gbank_active(void) {
+	return active;
+}
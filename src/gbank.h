@@ -0,0 +1,34 @@
+/*
+Goertzel bank for tracking a locked note between full FFTs.
+Once the tuner has settled on a note only the few cents around it matter, so instead of a 512-point
+FFT plus zoom per estimate, GBANK_BINS single-frequency Goertzel filters spaced step_cents apart are run
+over the last n decimated samples (Hann-windowed), around the current estimate:
+	s[i] = x[i] + 2*cos(w)*s[i-1] - s[i-2],   |X(w)|^2 = s1^2 + s2^2 - 2*cos(w)*s1*s2
+That is one multiply and two adds per sample and filter, about a third of the FFT + zoom for 16 filters.
+The magnitudes come out on the same scale as fft_real on a Hann-windowed frame, so PKMAG_MIN applies.
+
+	gbank_start - fills the history from a full raw frame (the one the FFT just analyzed, raw_len = n*decim),
+	              n <= GBANK_MAX_N, n must match window's length
+	gbank_push  - slides a new raw block in: decimation, DC removal (the starting frame's DC), scale to volts
+	gbank_peak  - runs the bank around f_center on the windowed history and refines the strongest filter
+	              with a parabola through its neighbors; returns the frequency, *peak_mag gets its squared
+	              magnitude and *edge 1 if the strongest filter is the first or last one (the note has
+	              moved out of the bank)
+	gbank_stop / gbank_active - leave / query tracking
+*/
+
+#ifndef GBANK_H
+#define GBANK_H
+
+#include <stdint.h>
+
+#define GBANK_MAX_N 512
+#define GBANK_BINS  16
+
+void gbank_start(const int32_t* raw, int raw_len, int decim, int n, float scale);
+void gbank_push(const int32_t* raw, int raw_len, int decim, float scale);
+float gbank_peak(const float* window, float sample_f, float f_center, float step_cents, float* peak_mag, int* edge);
+void gbank_stop(void);
+int gbank_active(void);
+
+#endif
@@ -124,6 +124,9 @@ int main(void) {
                 case 3:   // BTNR -> CAL
                     dispatch(BTN_CAL_SIG);
                     break;
+                case 4:   // BTND -> STRUM
+                    dispatch(BTN_STRUM_SIG);
+                    break;
                 default:
                     break;
             }
@@ -1,4 +1,5 @@
 #include "note.h"
+#include "fft_tables.h"
 #include <math.h>
 //#include "lcd.h"
 
@@ -83,12 +84,11 @@ void findNoteDetailed(float freq, float a4_ref_hz, const char** noteNameOut, int
 	int midi_round = (int)(midi + 0.5f);
 
 	// clamp to a sane range (A0..C8)
-	if (midi_round < 21)  midi_round = 21;   // A0
-	if (midi_round > 108) midi_round = 108;  // C8
+	if (midi_round < NOTE_MIDI_LO) midi_round = NOTE_MIDI_LO;   // A0
+	if (midi_round > NOTE_MIDI_HI) midi_round = NOTE_MIDI_HI;   // C8
 
-	// ideal frequency of that rounded MIDI note
-	float nearestFreq = a4_ref_hz *
-		powf(2.0f, (float)(midi_round - 69) / 12.0f);
+	// ideal frequency of that rounded MIDI note (ratio table from fft_tables.c)
+	float nearestFreq = a4_ref_hz * note_ratio_a4[midi_round - NOTE_MIDI_LO];
 
 	// cents offset between measured freq and ideal
 	float cents_f = 1200.0f * (logf(freq / nearestFreq) / logf(2.0f));
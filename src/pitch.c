@@ -0,0 +1,202 @@
+#include <stddef.h>
+#include "fft.h"
+#include "pitch.h"
+
+// 2n-point plan for the autocorrelation and its work buffers
+static fft_plan* acf_plan = NULL;
+static int acf_n = 0;
+static float acf_re[2 * PITCH_MAX_N];
+static float acf_im[2 * PITCH_MAX_N];
+
+// per-lag function of the engine (d' for YIN, nsdf for McLeod), lags 0 .. n/2
+static float lag_fn[PITCH_MAX_N / 2 + 2];
+
+
+/* Creates the autocorrelation plan for n-sample frames */
+int pitch_init(int n) {
+	if (n > PITCH_MAX_N) return -1;
+	if (acf_plan && acf_n == n) return 0;
+
+	if (acf_plan) fft_plan_destroy(acf_plan);
+	acf_plan = fft_plan_create(2 * n);
+	acf_n = acf_plan ? n : 0;
+	if (!acf_plan) return -1;
+
+	// only the transforms are needed, the peak search result is never read
+	fft_plan_set_peak_search(acf_plan, 0);
+	return 0;
+}
+
+
+/* Linear autocorrelation of x (n samples) into acf_re[0..n]: two real FFTs of the zero-padded frame */
+static void pitch_acf(const float* x, int n) {
+	int k;
+	int n2 = 2 * n;
+
+	for (k = 0; k < n; k++) {
+		acf_re[k] = x[k];
+		acf_re[n + k] = 0.0f;
+	}
+	fft_execute_real(acf_plan, acf_re, acf_im, 1.0f, NULL);
+
+	// power spectrum, even around n, so its (real) transform is the autocorrelation times 2n
+	for (k = 0; k <= n; k++) {
+		acf_re[k] = acf_re[k] * acf_re[k] + acf_im[k] * acf_im[k];
+	}
+	for (k = 1; k < n; k++) {
+		acf_re[n2 - k] = acf_re[k];
+	}
+	fft_execute_real(acf_plan, acf_re, acf_im, 1.0f, NULL);
+
+	for (k = 0; k <= n; k++) {
+		acf_re[k] *= 1.0f / (float)n2;
+	}
+}
+
+
+/* Offset of the vertex of the parabola through y1, y2, y3, within [-1, 1] */
+static float lag_offset(float y1, float y2, float y3) {
+	float denom = y1 - 2.0f * y2 + y3;
+	float delta = 0.0f;
+
+	if (denom != 0.0f) {
+		delta = 0.5f * (y1 - y3) / denom;
+		if (delta < -1.0f) delta = -1.0f;
+		if (delta >  1.0f) delta =  1.0f;
+	}
+	return delta;
+}
+
+
+/* Value at the vertex of the parabola through lag_fn[tau-1..tau+1]: a lobe only a few lags wide
+   (high notes) is mostly missed by the integer lags, so lobes are compared at their vertices */
+static float lag_vertex(int tau) {
+	float y1 = lag_fn[tau - 1];
+	float y2 = lag_fn[tau];
+	float y3 = lag_fn[tau + 1];
+	return y2 - 0.25f * (y1 - y3) * lag_offset(y1, y2, y3);
+}
+
+
+/* YIN: cumulative-mean normalized difference, first dip below the threshold; returns the lag (0 if none) */
+static float pitch_yin(const float* x, int n, int tau_min, int tau_max, float* clarity) {
+	int tau;
+	float m = 2.0f * acf_re[0];
+	float sum = 0.0f;
+	int best = 0;
+
+	lag_fn[0] = 1.0f;
+	for (tau = 1; tau <= tau_max + 1; tau++) {
+		m -= x[tau - 1] * x[tau - 1] + x[n - tau] * x[n - tau];
+		float d = m - 2.0f * acf_re[tau];
+		if (d < 0.0f) d = 0.0f;               // rounding on a near-perfect match
+		sum += d;
+		lag_fn[tau] = (sum > 0.0f) ? d * (float)tau / sum : 1.0f;
+	}
+
+	// first dip whose bottom is under the threshold
+	for (tau = tau_min; tau <= tau_max; tau++) {
+		if (lag_fn[tau] <= lag_fn[tau - 1] && lag_fn[tau] < lag_fn[tau + 1] &&
+		    lag_vertex(tau) < PITCH_YIN_THRESHOLD) {
+			best = tau;
+			break;
+		}
+	}
+	if (!best) {
+		// nothing under the threshold: the deepest dip, reported with its (low) clarity
+		best = tau_min;
+		for (tau = tau_min + 1; tau <= tau_max; tau++) {
+			if (lag_fn[tau] < lag_fn[best]) best = tau;
+		}
+	}
+
+	*clarity = 1.0f - lag_vertex(best);
+	if (*clarity < 0.0f) *clarity = 0.0f;
+	if (*clarity > 1.0f) *clarity = 1.0f;
+	return (float)best + lag_offset(lag_fn[best - 1], lag_fn[best], lag_fn[best + 1]);
+}
+
+
+/* McLeod: normalized square difference, first key maximum within PITCH_MPM_K of the highest */
+static float pitch_mpm(const float* x, int n, int tau_min, int tau_max, float* clarity) {
+	int tau;
+	float m = 2.0f * acf_re[0];
+	float top = 0.0f;
+	int best = 0;
+
+	lag_fn[0] = 1.0f;
+	for (tau = 1; tau <= tau_max + 1; tau++) {
+		m -= x[tau - 1] * x[tau - 1] + x[n - tau] * x[n - tau];
+		lag_fn[tau] = (m > 0.0f) ? 2.0f * acf_re[tau] / m : 0.0f;
+	}
+
+	// highest key maximum: the top of each positive lobe after the first negative stretch
+	tau = 1;
+	while (tau <= tau_max && lag_fn[tau] > 0.0f) tau++;
+	for (; tau <= tau_max; tau++) {
+		if (lag_fn[tau] > lag_fn[tau - 1] && lag_fn[tau] >= lag_fn[tau + 1] && lag_fn[tau] > 0.0f &&
+		    tau >= tau_min && lag_vertex(tau) > top) {
+			top = lag_vertex(tau);
+		}
+	}
+	if (top <= 0.0f) {
+		*clarity = 0.0f;
+		return 0.0f;
+	}
+
+	// first key maximum that comes close to it (the fundamental, not a multiple of its period)
+	tau = 1;
+	while (tau <= tau_max && lag_fn[tau] > 0.0f) tau++;
+	for (; tau <= tau_max; tau++) {
+		if (tau >= tau_min && lag_fn[tau] > lag_fn[tau - 1] && lag_fn[tau] >= lag_fn[tau + 1] &&
+		    lag_vertex(tau) >= PITCH_MPM_K * top) {
+			best = tau;
+			break;
+		}
+	}
+
+	*clarity = lag_vertex(best);
+	if (*clarity > 1.0f) *clarity = 1.0f;
+	return (float)best + lag_offset(lag_fn[best - 1], lag_fn[best], lag_fn[best + 1]);
+}
+
+
+/* YIN / McLeod pitch of one frame (see pitch.h) */
+float pitch_estimate(int engine, const float* x, int n, float sample_f, float f_min, float f_max, pitch_result* out) {
+	float clarity = 0.0f;
+	float lag = 0.0f;
+	float frequency = 0.0f;
+
+	if (out) {
+		out->frequency = 0.0f;
+		out->clarity = 0.0f;
+		out->power = 0.0f;
+	}
+	if (!acf_plan || n != acf_n || f_max <= 0.0f) return 0.0f;
+
+	// periods searched: two of them have to fit in the frame
+	int tau_max = (f_min > 0.0f) ? (int)(sample_f / f_min) + 1 : n / 2;
+	int tau_min = (int)(sample_f / f_max);
+	if (tau_max > n / 2) tau_max = n / 2;
+	if (tau_min < 2) tau_min = 2;
+	if (tau_min >= tau_max) return 0.0f;
+
+	pitch_acf(x, n);
+
+	if (out) out->power = acf_re[0] / (float)n;
+	if (acf_re[0] <= 0.0f) return 0.0f;
+
+	if (engine == PITCH_ENGINE_YIN) {
+		lag = pitch_yin(x, n, tau_min, tau_max, &clarity);
+	} else {
+		lag = pitch_mpm(x, n, tau_min, tau_max, &clarity);
+	}
+
+	if (lag > 0.0f) frequency = sample_f / lag;
+
+	if (out) {
+		out->frequency = frequency;
+		out->clarity = clarity;
+	}
+	return frequency;
+}
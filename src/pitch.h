@@ -0,0 +1,46 @@
+/*
+Time-domain pitch engines (YIN and McLeod's NSDF) as an alternative to the FFT peak search.
+Both look for the lag at which the frame best matches a shifted copy of itself, so a strong harmonic
+can't win over the fundamental the way it can in a spectrum argmax, and the lag is interpolated
+independently of the FFT's bin spacing.
+Both are built on the linear autocorrelation r(tau) = sum x[j]*x[j+tau], computed with two real FFTs of
+the zero-padded frame (power spectrum, then its transform) on a 2n-point fft_plan: O(n log n) instead of
+the O(n^2) direct sum.
+	m(tau) = sum over the overlap of x[j]^2 + x[j+tau]^2   (running update, O(1) per lag)
+	YIN:    d(tau) = m(tau) - 2*r(tau) = sum (x[j] - x[j+tau])^2, cumulative-mean normalized; the first
+	        lag below PITCH_YIN_THRESHOLD (then its local minimum) is the period, clarity = 1 - d'(tau)
+	McLeod: nsdf(tau) = 2*r(tau) / m(tau) in [-1, 1]; among the maxima of the positive lobes, the first
+	        within PITCH_MPM_K of the highest is the period, clarity = nsdf at that lag
+The chosen lag is refined by a parabola through its neighbors.
+
+	pitch_init     - sets up the 2n-point plan for frames of n <= PITCH_MAX_N samples (heap, once);
+	                 returns 0, or -1 if the plan can't be created (pitch_estimate then returns 0)
+	pitch_estimate - runs engine (PITCH_ENGINE_YIN / MPM) on the n samples x (decimated, DC removed,
+	                 NOT windowed) and searches periods for f_min..f_max (at most 2 per frame, f_min is
+	                 raised to sample_f * 2 / n if needed). Returns the frequency (0 if no period was
+	                 found) and fills out, if not NULL, with the frequency, clarity (0..1) and the
+	                 frame's mean square.
+*/
+
+#ifndef PITCH_H
+#define PITCH_H
+
+/* Pitch engines; PITCH_ENGINE_FFT is the spectrum peak in fft.c, the tuner dispatches it itself */
+#define PITCH_ENGINE_FFT 0
+#define PITCH_ENGINE_YIN 1
+#define PITCH_ENGINE_MPM 2
+
+#define PITCH_MAX_N          512
+#define PITCH_YIN_THRESHOLD  0.15f
+#define PITCH_MPM_K          0.9f
+
+typedef struct {
+	float frequency;    // Hz, 0 if no period found
+	float clarity;      // 0..1, how periodic the frame is at that period
+	float power;        // mean square of the frame
+} pitch_result;
+
+int pitch_init(int n);
+float pitch_estimate(int engine, const float* x, int n, float sample_f, float f_min, float f_max, pitch_result* out);
+
+#endif
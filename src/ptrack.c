@@ -0,0 +1,180 @@
+#include <math.h>
+#include "ptrack.h"
+
+#define LN2 0.69314718f
+
+// tracked pitch in cents from A4, and its variance (cents^2)
+static float track_x = 0.0f;
+static float track_p = 0.0f;
+static int valid = 0;
+
+// last PTRACK_WINDOW estimates (cents), oldest overwritten first
+static float window[PTRACK_WINDOW];
+static int win_count = 0;
+static int win_pos = 0;
+
+static int misses = 0;
+
+// consecutive innovations on one side of the reading: > 0 above, < 0 below
+static int run = 0;
+
+// after an attack: estimates left to wait, and the previous one
+static int settle = 0;
+static float settle_last = 0.0f;
+static int settle_have = 0;
+
+
+/* Hz <-> cents from A4 */
+static float to_cents(float f) {
+	return 1200.0f * logf(f / 440.0f) / LN2;
+}
+
+static float to_hz(float c) {
+	return 440.0f * expf(c * (LN2 / 1200.0f));
+}
+
+
+/* How many estimates in the window lie within PTRACK_AGREE_CENTS of c */
+static int window_votes(float c) {
+	int i;
+	int votes = 0;
+
+	for (i = 0; i < win_count; i++) {
+		if (fabsf(window[i] - c) < PTRACK_AGREE_CENTS) votes++;
+	}
+	return votes;
+}
+
+
+/* 1 if the window, oldest to newest, climbs or falls in even steps (within PTRACK_AGREE_CENTS of each
+   other, none over PTRACK_GLIDE_MAX_CENTS): a peg being turned, not an outlier */
+static int window_glide(void) {
+	int i;
+	float first = 0.0f;
+
+	if (win_count < PTRACK_WINDOW) return 0;
+	for (i = 1; i < PTRACK_WINDOW; i++) {
+		float step = window[(win_pos + i) % PTRACK_WINDOW] - window[(win_pos + i - 1) % PTRACK_WINDOW];
+		if (fabsf(step) > PTRACK_GLIDE_MAX_CENTS) return 0;
+		if (i == 1) {
+			first = step;
+		} else if (fabsf(step - first) >= PTRACK_AGREE_CENTS || step * first <= 0.0f) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+
+static void window_push(float c) {
+	window[win_pos] = c;
+	win_pos = (win_pos + 1) % PTRACK_WINDOW;
+	if (win_count < PTRACK_WINDOW) win_count++;
+}
+
+
+/* Jumps to c with the measurement's variance, the window restarts from it */
+static void snap(float c, float r) {
+	track_x = c;
+	track_p = r;
+	valid = 1;
+	settle = 0;
+	run = 0;
+	win_count = 0;
+	win_pos = 0;
+	window_push(c);
+}
+
+
+/* One estimate, see ptrack.h */
+float ptrack_update(float frequency, float snr) {
+	float c = to_cents(frequency);
+
+	if (snr < 1.0f) snr = 1.0f;
+	float r = PTRACK_R_MIN + PTRACK_R_SNR / snr;
+
+	misses = 0;
+	window_push(c);
+
+	if (!valid) {
+		// first reading, straight there
+		snap(c, r);
+		return to_hz(track_x);
+	}
+
+	if (settle > 0) {
+		// new note after an attack: two estimates that agree replace the reading outright;
+		// until then it holds (or plain tracking resumes after PTRACK_SETTLE_MAX)
+		settle--;
+		if (settle_have && fabsf(c - settle_last) < PTRACK_AGREE_CENTS) {
+			snap(c, r);
+			return to_hz(track_x);
+		}
+		settle_last = c;
+		settle_have = 1;
+		if (settle > 0) return to_hz(track_x);
+	}
+
+	float d = c - track_x;
+
+	// estimates that keep landing over a sigma away on one side: the pitch is moving (a peg being turned),
+	// not noise; the drift allowed per estimate doubles with each one after the first
+	float sigma = sqrtf(track_p + PTRACK_Q + r);
+	if (d > sigma) {
+		run = (run > 0) ? run + 1 : 1;
+	} else if (d < -sigma) {
+		run = (run < 0) ? run - 1 : -1;
+	} else {
+		run = 0;
+	}
+	int shift = (run > 0) ? run - 1 : (run < 0) ? -run - 1 : 0;
+	if (shift > PTRACK_GLIDE_SHIFT_MAX) shift = PTRACK_GLIDE_SHIFT_MAX;
+	track_p += PTRACK_Q * (float)(1 << shift);
+
+	float gate = 3.0f * sqrtf(track_p + r);
+	if (gate < PTRACK_GATE_CENTS) gate = PTRACK_GATE_CENTS;
+
+	if (fabsf(d) <= gate) {
+		float k = track_p / (track_p + r);
+		track_x += k * d;
+		track_p *= 1.0f - k;
+	} else if (window_votes(c) == PTRACK_WINDOW) {
+		// a note change keeps coming back, an outlier (octave error, pick noise) doesn't
+		snap(c, r);
+	} else if (window_glide()) {
+		// a fast glide outruns the gate: follow it, the window keeps watching the steps
+		track_x = c;
+		track_p = r;
+	}
+	return to_hz(track_x);
+}
+
+
+/* No estimate this time: hold, then let go */
+float ptrack_miss(void) {
+	if (!valid) return 0.0f;
+	if (++misses > PTRACK_HOLD) {
+		ptrack_reset();
+		return 0.0f;
+	}
+	return to_hz(track_x);
+}
+
+
+/* Attack: wait for the new note */
+void ptrack_onset(void) {
+	settle = PTRACK_SETTLE_MAX;
+	settle_have = 0;
+}
+
+
+/* Forgets the note */
+void ptrack_reset(void) {
+	valid = 0;
+	misses = 0;
+	settle = 0;
+	settle_have = 0;
+	run = 0;
+	win_count = 0;
+	win_pos = 0;
+}
@@ -0,0 +1,45 @@
+/*
+Pitch tracker between the per-frame estimates and the display.
+A fixed exponential smoother trades settling time against steadiness in one knob, and a single bad frame
+(octave error, pick noise) pulls it for several frames. Here the estimate is tracked in cents:
+	- a scalar Kalman filter (random walk, PTRACK_Q per estimate) whose measurement variance comes from
+	  the frame's confidence: PTRACK_R_MIN + PTRACK_R_SNR / snr, snr = peak magnitude over PKMAG_MIN.
+	  Strong frames move the reading almost at once, frames near the threshold only nudge it
+	- an innovation gate (3 sigma, at least PTRACK_GATE_CENTS): an estimate outside it is checked against
+	  the last PTRACK_WINDOW estimates. If all of them (itself included) agree with it within
+	  PTRACK_AGREE_CENTS, the note has changed and the tracker snaps to it; if they climb or fall in even
+	  steps it is a glide and the tracker follows; otherwise it is an outlier (octave error, pick noise)
+	  and is dropped
+	- a glide (a peg being turned) shows as estimates landing more than a sigma away on the same side
+	  again and again; each one in a row doubles PTRACK_Q (up to 2^PTRACK_GLIDE_SHIFT_MAX), so the reading
+	  keeps up with the pitch instead of lagging behind it, and a steady note keeps the small PTRACK_Q
+	- after an attack (ptrack_onset) the next estimates wait until two in a row agree, then snap; plain
+	  tracking resumes after PTRACK_SETTLE_MAX estimates
+	- a missing estimate (too weak, no period) holds the reading for PTRACK_HOLD calls, then drops it
+
+	ptrack_update - one estimate (Hz, > 0) with its snr (>= 1); returns the tracked frequency (Hz)
+	ptrack_miss   - no estimate this time; returns the held frequency, 0 once the hold has run out
+	ptrack_onset  - an attack was seen, the next estimates belong to a new note
+	ptrack_reset  - forget the note
+*/
+
+#ifndef PTRACK_H
+#define PTRACK_H
+
+#define PTRACK_WINDOW       3
+#define PTRACK_Q            0.25f    // cents^2 of drift between estimates
+#define PTRACK_R_MIN        4.0f     // cents^2, even a strong frame isn't exact (inharmonicity, beating)
+#define PTRACK_R_SNR        25.0f    // cents^2 at the PKMAG_MIN threshold
+#define PTRACK_GATE_CENTS   35.0f
+#define PTRACK_AGREE_CENTS  15.0f
+#define PTRACK_GLIDE_SHIFT_MAX  6
+#define PTRACK_GLIDE_MAX_CENTS  100.0f   // a bigger step between estimates is no glide
+#define PTRACK_SETTLE_MAX   4
+#define PTRACK_HOLD         4
+
+float ptrack_update(float frequency, float snr);
+float ptrack_miss(void);
+void ptrack_onset(void);
+void ptrack_reset(void);
+
+#endif
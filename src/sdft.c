@@ -0,0 +1,196 @@
+#include <stdint.h>
+#include <math.h>
+#include "sdft.h"
+
+#define TWO_PI 6.28318531f
+
+// tracked bins lo-1 .. hi+1
+#define MAX_TRACKED (SDFT_MAX_BINS + 2)
+
+
+// last n decimated samples (volts), hist_pos is the oldest
+static float hist[SDFT_MAX_N];
+static int hist_pos = 0;
+static int sdft_n = 0;
+
+// running bins and their per-sample rotation r * exp(j*2*PI*k/n), index 0 is bin lo-1
+static float bin_re[MAX_TRACKED];
+static float bin_im[MAX_TRACKED];
+static float rot_re[MAX_TRACKED];
+static float rot_im[MAX_TRACKED];
+static int bin_lo = 0;
+static int bin_count = 0;
+
+// DC of the starting frame; a constant offset only lands in bin 0, but a per-block
+// average would step with the partial periods in each block and leak into low notes
+static int32_t frame_dc = 0;
+
+// r^n, weight of the sample leaving the window
+static float damp_n = 1.0f;
+
+static int active = 0;
+
+
+/* Average of raw_len samples */
+static int32_t raw_dc(const int32_t* raw, int raw_len) {
+	int i;
+	int64_t sum = 0;
+	for (i = 0; i < raw_len; i++) {
+		sum += raw[i];
+	}
+	return (int32_t)(sum / raw_len);
+}
+
+
+/* Starts tracking bins lo..hi over the n decimated samples of a full raw frame */
+void sdft_start(const int32_t* raw, int raw_len, int decim, int n, float scale, int lo, int hi) {
+	int i, b;
+
+	if (n > SDFT_MAX_N) n = SDFT_MAX_N;
+	if (lo < 2) lo = 2;                          // keep lo-1 clear of DC
+	if (hi > n / 2 - 2) hi = n / 2 - 2;
+	if (hi - lo + 1 > SDFT_MAX_BINS) hi = lo + SDFT_MAX_BINS - 1;
+	if (hi < lo) {
+		active = 0;
+		return;
+	}
+
+	sdft_n = n;
+	bin_lo = lo - 1;
+	bin_count = hi - lo + 3;
+	hist_pos = 0;
+
+	frame_dc = raw_dc(raw, raw_len);
+	for (i = 0; i < n; i++) {
+		int idx = i * decim;
+		hist[i] = (idx < raw_len) ? (float)(raw[idx] - frame_dc) * scale : 0.0f;
+	}
+
+	damp_n = powf(SDFT_DAMP, (float)n);
+
+	// direct DFT of the history for the tracked bins, with the same damping the updates apply
+	for (b = 0; b < bin_count; b++) {
+		float theta = TWO_PI * (float)(bin_lo + b) / (float)n;
+		float c = cosf(theta);
+		float s = sinf(theta);
+		float pr = 1.0f, pi = 0.0f;             // exp(-j*theta*i)
+		float re = 0.0f, im = 0.0f;
+		float weight = damp_n;                  // r^(n-i)
+
+		for (i = 0; i < n; i++) {
+			float x = weight * hist[i];
+			re += x * pr;
+			im += x * pi;
+
+			float t = pr * c + pi * s;
+			pi = pi * c - pr * s;
+			pr = t;
+			weight *= (1.0f / SDFT_DAMP);
+		}
+		bin_re[b] = re;
+		bin_im[b] = im;
+		rot_re[b] = SDFT_DAMP * c;
+		rot_im[b] = SDFT_DAMP * s;
+	}
+
+	active = 1;
+}
+
+
+/* Slides one raw block into the tracked bins, one decimated sample at a time (DC from sdft_start) */
+void sdft_push(const int32_t* raw, int raw_len, int decim, float scale) {
+	int i, b;
+
+	if (!active) return;
+
+	for (i = 0; i < raw_len; i += decim) {
+		float x = (float)(raw[i] - frame_dc) * scale;
+		float delta = x - damp_n * hist[hist_pos];
+
+		hist[hist_pos] = x;
+		hist_pos++;
+		if (hist_pos == sdft_n) hist_pos = 0;
+
+		for (b = 0; b < bin_count; b++) {
+			float re = bin_re[b] + delta;
+			float im = bin_im[b];
+			bin_re[b] = re * rot_re[b] - im * rot_im[b];
+			bin_im[b] = re * rot_im[b] + im * rot_re[b];
+		}
+	}
+}
+
+
+/* Squared magnitude of tracked bin b after the frequency-domain Hann window */
+static float hann_mag2(int b) {
+	float re = 0.5f * bin_re[b] - 0.25f * (bin_re[b - 1] + bin_re[b + 1]);
+	float im = 0.5f * bin_im[b] - 0.25f * (bin_im[b - 1] + bin_im[b + 1]);
+	return re * re + im * im;
+}
+
+
+/* Peak of the windowed tracked bins, two-bin Hann ratio interpolation */
+float sdft_peak(float sample_f, int* peak_bin, float* peak_mag) {
+	int b, place;
+	float mag2[MAX_TRACKED];
+	float max = 0.0f;
+
+	if (peak_bin) *peak_bin = 0;
+	if (peak_mag) *peak_mag = 0.0f;
+	if (!active) return 0.0f;
+
+	place = 1;
+	for (b = 1; b < bin_count - 1; b++) {
+		mag2[b] = hann_mag2(b);
+		if (mag2[b] > max) {
+			max = mag2[b];
+			place = b;
+		}
+	}
+
+	if (peak_bin) *peak_bin = bin_lo + place;
+	if (peak_mag) *peak_mag = max;
+	if (max <= 0.0f) return 0.0f;
+
+	float bin_spacing = sample_f / (float)sdft_n;
+	float delta = 0.0f;
+
+	// Hann main lobe: |Y(k+d)| / |Y(k)| = alpha gives d = (2*alpha - 1) / (alpha + 1)
+	int side = 0;
+	if (place + 1 < bin_count - 1 && (place - 1 < 1 || mag2[place + 1] >= mag2[place - 1])) {
+		side = 1;
+	} else if (place - 1 >= 1) {
+		side = -1;
+	}
+	if (side) {
+		float alpha = sqrtf(mag2[place + side] / max);
+		delta = (float)side * (2.0f * alpha - 1.0f) / (alpha + 1.0f);
+	}
+
+	return ((float)(bin_lo + place) + delta) * bin_spacing;
+}
+
+
+/* Copies the current window of n samples (oldest first) to x, times window if not NULL */
+void sdft_frame(float* x, const float* window) {
+	int i;
+	int pos = hist_pos;
+
+	for (i = 0; i < sdft_n; i++) {
+		x[i] = window ? hist[pos] * window[i] : hist[pos];
+		pos++;
+		if (pos == sdft_n) pos = 0;
+	}
+}
+
+
+/* Leaves tracking */
+void sdft_stop(void) {
+	active = 0;
+}
+
+
+/* Getter */
+int sdft_active(void) {
+	return active;
+}
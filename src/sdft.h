@@ -0,0 +1,35 @@
+/*
+Sliding DFT for tracking a sustained note block by block instead of re-running the FFT on a whole frame.
+A few bins around the note are kept as running sums over the last n decimated samples; every new sample
+updates each of them in O(1):
+	X_k <- r * exp(j*2*PI*k/n) * (X_k + x_new - r^n * x_old)
+r (SDFT_DAMP) sits just below 1 so float rounding can't accumulate. The Hann window is applied in the
+frequency domain (0.5*X_k - 0.25*(X_k-1 + X_k+1)), which is why bins lo-1 .. hi+1 are tracked, and the
+peak magnitudes come out on the same scale as fft_real on a Hann-windowed frame.
+
+	sdft_start - fills the history from a full raw frame (the one the FFT just analyzed, raw_len = n*decim)
+	             and computes bins lo..hi directly, n <= SDFT_MAX_N, hi - lo + 1 <= SDFT_MAX_BINS
+	sdft_push  - slides a new raw block in: decimation, DC removal (the starting frame's DC), scale to volts
+	sdft_peak  - strongest windowed bin in lo..hi, refined with the two-bin Hann ratio interpolator;
+	             returns the frequency, *peak_bin / *peak_mag get the bin and its squared magnitude
+	sdft_frame - the n samples currently in the window, oldest first (optionally windowed), e.g. for fft_zoom
+	sdft_stop / sdft_active - leave / query tracking
+*/
+
+#ifndef SDFT_H
+#define SDFT_H
+
+#include <stdint.h>
+
+#define SDFT_MAX_N    512
+#define SDFT_MAX_BINS 32
+#define SDFT_DAMP     0.99998f
+
+void sdft_start(const int32_t* raw, int raw_len, int decim, int n, float scale, int lo, int hi);
+void sdft_push(const int32_t* raw, int raw_len, int decim, float scale);
+float sdft_peak(float sample_f, int* peak_bin, float* peak_mag);
+void sdft_frame(float* x, const float* window);
+void sdft_stop(void);
+int sdft_active(void);
+
+#endif
@@ -37,6 +37,9 @@ static volatile uint32_t* const reg_seq_counter = (uint32_t*)(XPAR_STREAM_GRABBE
 static volatile uint32_t* const reg_seq_counter_latched = (uint32_t*)(XPAR_STREAM_GRABBER_0_BASEADDR+16);
 
 
+// duration of the last block readout, in sequence-counter ticks
+static unsigned last_readout_ticks = 0;
+
 
 /* Functions */
 
@@ -62,6 +65,38 @@ int stream_grabber_read_sample(unsigned which_sample)
 	return *reg_readout_value;
 }
 
+// copy count samples starting at index first into dst; the register pointers stay in registers and
+// there is no call per sample, so each sample costs just its address write and value read
+void stream_grabber_read_block(int32_t* dst, unsigned first, unsigned count)
+{
+	volatile uint32_t* const addr = reg_readout_addr;
+	volatile int32_t* const value = reg_readout_value;
+	unsigned t0 = *reg_seq_counter;
+	unsigned i = 0;
+
+	for (; i + 4 <= count; i += 4) {
+		*addr = first + i;
+		dst[i] = *value;
+		*addr = first + i + 1;
+		dst[i + 1] = *value;
+		*addr = first + i + 2;
+		dst[i + 2] = *value;
+		*addr = first + i + 3;
+		dst[i + 3] = *value;
+	}
+	for (; i < count; i++) {
+		*addr = first + i;
+		dst[i] = *value;
+	}
+
+	last_readout_ticks = *reg_seq_counter - t0;
+}
+
+// sequence-counter ticks the last stream_grabber_read_block took
+unsigned stream_grabber_last_readout_ticks() {
+	return last_readout_ticks;
+}
+
 // return internal value of sequence counter
 unsigned stream_grabber_read_seq_counter() {
 	return *reg_seq_counter;
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <stdint.h>
+
 void stream_grabber_start();
 unsigned stream_grabber_samples_sampled_captures(), stream_grabber_read_seq_counter(), stream_grabber_read_seq_counter_latched();
 void stream_grabber_wait_enough_samples(unsigned required_samples);
 int stream_grabber_read_sample(unsigned which_sample);
+void stream_grabber_read_block(int32_t* dst, unsigned first, unsigned count);
+unsigned stream_grabber_last_readout_ticks();
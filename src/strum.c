@@ -0,0 +1,102 @@
+#include <math.h>
+#include "fft.h"
+#include "strum.h"
+
+
+/* How partial h of string s sits among the other strings' partials (up to harmonic max_k):
+   2 = alone, 1 = shared only with higher harmonics of other strings, 0 = taken by another string */
+static int strum_owner(const float* targets, int count, int s, int h, int max_k, float collide_hz) {
+	int o, k;
+	int own = 2;
+	float f = (float)h * targets[s];
+
+	for (o = 0; o < count; o++) {
+		if (o == s) continue;
+		for (k = 1; k <= max_k; k++) {
+			if (fabsf((float)k * targets[o] - f) < collide_hz) {
+				if (k <= h) return 0;
+				own = 1;
+			}
+		}
+	}
+	return own;
+}
+
+
+/* Interpolated frequency of the strongest local maximum within STRUM_SEARCH_CENTS of f (at least the nearest
+   bin and its neighbors), 0 if there is none or it falls outside; *peak gets its squared magnitude */
+static float strum_partial(const float* mag, int nbins, int n, float bin_hz, float f, float* peak) {
+	float ratio = powf(2.0f, STRUM_SEARCH_CENTS / 1200.0f);
+	int center = (int)(f / bin_hz + 0.5f);
+	int lo = (int)(f / ratio / bin_hz + 0.5f);
+	int hi = (int)(f * ratio / bin_hz + 0.5f);
+	int k, place = 0;
+	float max = 0.0f;
+
+	*peak = 0.0f;
+	if (lo > center - 1) lo = center - 1;
+	if (hi < center + 1) hi = center + 1;
+	if (lo < 1) lo = 1;
+	if (hi > nbins - 2) hi = nbins - 2;
+
+	for (k = lo; k <= hi; k++) {
+		if (mag[k] > max && mag[k] >= mag[k - 1] && mag[k] >= mag[k + 1]) {
+			max = mag[k];
+			place = k;
+		}
+	}
+	if (!place) return 0.0f;
+
+	float y1 = mag[place - 1] * mag[place - 1];
+	float y2 = max * max;
+	float y3 = mag[place + 1] * mag[place + 1];
+	float found = ((float)place + fft_interp_offset(FFT_INTERP_JAIN, y1, y2, y3, n)) * bin_hz;
+
+	if (found < f / ratio || found > f * ratio) return 0.0f;
+	*peak = y2;
+	return found;
+}
+
+
+/* Note and cents of every string from one spectrum (see strum.h) */
+int strum_analyze(const float* mag, int nbins, int n, float bin_hz, const float* targets, int count,
+                  float mag_min, strum_string* out) {
+	int s, h;
+	int found = 0;
+	float collide_hz = STRUM_COLLIDE_BINS * bin_hz;
+
+	if (count > STRUM_MAX_STRINGS) count = STRUM_MAX_STRINGS;
+
+	for (s = 0; s < count; s++) {
+		float sum[3] = { 0.0f, 0.0f, 0.0f };
+		float weight[3] = { 0.0f, 0.0f, 0.0f };
+		float strongest[3] = { 0.0f, 0.0f, 0.0f };
+
+		for (h = 1; h <= STRUM_HARMONICS; h++) {
+			float peak;
+
+			if ((float)h * targets[s] >= (float)(nbins - 2) * bin_hz) break;
+			int own = strum_owner(targets, count, s, h, STRUM_OTHER_HARMONICS, collide_hz);
+			if (!own) continue;
+
+			float f = strum_partial(mag, nbins, n, bin_hz, (float)h * targets[s], &peak);
+			if (f <= 0.0f || peak < mag_min) continue;
+
+			float w = sqrtf(peak);
+			sum[own] += w * f / (float)h;
+			weight[own] += w;
+			if (peak > strongest[own]) strongest[own] = peak;
+		}
+
+		// partials no other string shares if there are any, the shared ones otherwise
+		int use = (weight[2] > 0.0f) ? 2 : 1;
+		float estimate = (weight[use] > 0.0f) ? sum[use] / weight[use] : 0.0f;
+
+		out[s].valid = (estimate > 0.0f);
+		out[s].frequency = estimate;
+		out[s].cents = out[s].valid ? 1200.0f * logf(out[s].frequency / targets[s]) / 0.69314718f : 0.0f;
+		out[s].mag = strongest[use];
+		found += out[s].valid;
+	}
+	return found;
+}
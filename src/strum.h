@@ -0,0 +1,38 @@
+/*
+Polyphonic strum check: note and cents of every open string at once, from one spectrum of a strummed chord.
+Each string is measured on its own partials (harmonics 1..STRUM_HARMONICS of its target). The strings of a
+guitar share many of them (E4 is the 4th harmonic of E2, B3 almost its 3rd, A2's 3rd is E4 ...), so a
+partial that lands within STRUM_COLLIDE_BINS of another string's partial is only used by the string for which
+it is the lower harmonic, the one that usually carries more energy; every string keeps its fundamental.
+Each usable partial's peak is searched within STRUM_SEARCH_CENTS (at least one bin) of where it should be,
+refined with the Jain interpolator (fft_interp_offset) and divided by its harmonic number; the estimates are
+averaged with the peak magnitudes as weights.
+Coinciding partials of two mistuned strings still merge into one peak, so the check is meant for a quick
+pass over roughly tuned strings; a string the spectrum can't place is reported as not valid.
+
+	strum_analyze - mag[0..nbins-1] = |X[k]| of a Hann-windowed frame of n samples (fft_plan_set_spectrum),
+	                bin_hz apart; targets[0..count-1] the open-string frequencies (count <= STRUM_MAX_STRINGS);
+	                a partial counts if its squared magnitude is at least mag_min. Fills out[] per string and
+	                returns how many strings were found.
+*/
+
+#ifndef STRUM_H
+#define STRUM_H
+
+#define STRUM_MAX_STRINGS   6
+#define STRUM_HARMONICS     3
+#define STRUM_COLLIDE_BINS  2.5f    // Hann main lobe is +-2 bins, plus a margin
+#define STRUM_SEARCH_CENTS  60.0f
+#define STRUM_OTHER_HARMONICS 8     // harmonics of the other strings that can overlap a partial
+
+typedef struct {
+	float frequency;    // Hz, 0 if not found
+	float cents;        // vs the target
+	float mag;          // squared magnitude of the strongest partial used
+	int   valid;
+} strum_string;
+
+int strum_analyze(const float* mag, int nbins, int n, float bin_hz, const float* targets, int count,
+                  float mag_min, strum_string* out);
+
+#endif
@@ -2,6 +2,14 @@
 #include "qpn_port.h"
 #include "tuner.h"
 #include "fft.h"
+#include "fft_fixed.h"
+#include "fft_tables.h"
+#include "sdft.h"
+#include "gbank.h"
+#include "strum.h"
+#include "pitch.h"
+#include "decim.h"
+#include "ptrack.h"
 #include "note.h"
 #include "stream_grabber.h"
 #include "xil_printf.h"
@@ -16,14 +24,171 @@
 
 #define DEBUG_NBINS 64
 
-#define RAW_BLOCKS     4
+// FIFO blocks per analysis frame: 4 -> 512-point FFT, 2 -> 256-point FFT at half the latency
+// (bins twice as wide, the interpolator and zoom make up for it)
+#ifndef TUNER_FRAME_BLOCKS
+#define TUNER_FRAME_BLOCKS 4
+#endif
+
+#define RAW_BLOCKS     TUNER_FRAME_BLOCKS
 #define RAW_SAMPLES    (RAW_BLOCKS * SAMPLES)   // 4 * 512 = 2048
 #define DECIM_FACTOR 4
 
+#define FRAME_N        (RAW_SAMPLES / DECIM_FACTOR)   // FFT length
+
+// set to 0 to decimate by taking every DECIM_FACTOR-th sample; otherwise each block goes through the
+// CIC + compensator of decim.c as it is read, so nothing above the decimated Nyquist folds into the band
+#ifndef TUNER_DECIM_FILTER
+#define TUNER_DECIM_FILTER 1
+#endif
+
+#if TUNER_DECIM_FILTER && DECIM_FACTOR != DECIM_R
+#error "decim.c decimates by DECIM_R only"
+#endif
+#if FRAME_N == FFT_HANN_N
+#define FRAME_M        M
+#define FRAME_WINDOW   fft_hann
+#elif FRAME_N == FFT_HANN_SHORT_N
+#define FRAME_M        (M - 1)
+#define FRAME_WINDOW   fft_hann_short
+#else
+#error "TUNER_FRAME_BLOCKS must give a frame of FFT_HANN_N or FFT_HANN_SHORT_N samples"
+#endif
+
 #define FREQ_CAL (440.0f / 453.0f) 	// about 0.971
 
+#define SAMPLE_SCALE (3.3f / 67108864.0f)	// volts per raw sample LSB
+
 #define PKMAG_MIN 3.0f
 
+// default instrument range searched for the fundamental
+#ifndef TUNER_F_MIN
+#define TUNER_F_MIN 80.0f      // E2 ~ 82.4 Hz
+#endif
+#ifndef TUNER_F_MAX
+#define TUNER_F_MAX 4200.0f    // C7 ~ 4186 Hz
+#endif
+
+// set to 1 on boards synthesized without the MicroBlaze FPU (integer FFT pipeline)
+#ifndef TUNER_FIXED_POINT
+#define TUNER_FIXED_POINT 0
+#endif
+
+#if TUNER_FIXED_POINT && FRAME_N != FFT_HANN_N
+#error "the fixed-point pipeline only has the 512-point window"
+#endif
+
+// interpolator that refines the FFT peak bin (FFT_INTERP_*, see fft.h); Quinn's complex-ratio
+// estimator has the lowest error with noise and keeps a 256-point frame within spec
+#ifndef TUNER_INTERP
+#define TUNER_INTERP FFT_INTERP_QUINN
+#endif
+
+// set to 0 to skip the zoom refinement after the FFT (float pipeline only)
+#ifndef TUNER_ZOOM
+#define TUNER_ZOOM 1
+#endif
+
+// set to 0 to report the strongest peak as is; otherwise a peak on the 2nd / 3rd harmonic
+// is moved down to the fundamental before the smoothing (FFT engine only)
+#ifndef TUNER_OCTAVE_FIX
+#define TUNER_OCTAVE_FIX 1
+#endif
+
+#define ZOOM_POINTS    16      // fine grid: 16 points over 2 bins, ~1/7.5 bin apart
+#define ZOOM_SPAN_BINS 2.0f
+
+// sustained-note tracker, at most one of the two (float pipeline only; with both 0 every estimate
+// analyzes a full frame). The default build uses TUNER_TRACK: a locked note moves the HSM to
+// Tuner_tracking, a Goertzel bank around it on each new block
+#ifndef TUNER_TRACK
+#define TUNER_TRACK 1
+#endif
+
+// the alternative, with TUNER_TRACK=0: a sustained note is tracked inside Tuner_tuning with a sliding DFT,
+// one captured block per estimate
+#ifndef TUNER_SDFT
+#define TUNER_SDFT 0
+#endif
+
+#if TUNER_TRACK && TUNER_SDFT
+#error "TUNER_TRACK and TUNER_SDFT are alternative trackers, set one of them to 0"
+#endif
+
+#define USE_TRACK (TUNER_TRACK && !TUNER_FIXED_POINT)
+#define USE_SDFT (TUNER_SDFT && !TUNER_FIXED_POINT)
+
+#define TRACK_STEP_CENTS 4.0f      // GBANK_BINS filters 4 cents apart, +-30 cents around the note
+
+// pitch engine for every mode at boot (PITCH_ENGINE_*, Tuner_setEngine changes it per mode);
+// the time-domain engines need the float pipeline and fall back to the FFT without it
+#ifndef TUNER_ENGINE
+#define TUNER_ENGINE PITCH_ENGINE_FFT
+#endif
+
+#define PITCH_CLARITY_MIN 0.6f     // below this a YIN / McLeod period counts as no note
+#define PITCH_ZOOM_SPAN   0.04f    // zoom span around a YIN / McLeod estimate, fraction of it (~70 cents)
+
+// set to 0 to always capture the full frame; otherwise main mode first tries a 512-point FFT of the
+// first raw block alone (undecimated, a quarter of the capture time) and stops there for a clear high note
+#ifndef TUNER_MULTIRES
+#define TUNER_MULTIRES 1
+#endif
+
+#define USE_MULTIRES (TUNER_MULTIRES && !TUNER_FIXED_POINT)
+
+#define MR_SPLIT_HZ   600.0f      // the short block only answers for notes above this (~6 of its bins)
+#define MR_LOW_RATIO  0.1f        // a peak below the split this strong could be the real fundamental
+#define MR_PEAKS      4
+
+#define SUSTAIN_FRAMES     3       // consecutive full frames within SUSTAIN_CENTS before tracking
+#define SUSTAIN_CENTS      20.0f
+#define SDFT_HALF_BAND     4       // bins tracked on each side of the note
+#define SDFT_ZOOM_POINTS   5       // the sliding estimate is already close, a short zoom grid is enough
+#define SDFT_ZOOM_SPAN_BINS 0.5f
+
+// set to 0 to feed every frame to the pitch tracker; otherwise a pick attack (a block much louder than the
+// one before it, measured while the samples are read) keeps its frame out, and the tracker waits for the
+// new note (ptrack_onset)
+#ifndef TUNER_ONSET
+#define TUNER_ONSET 1
+#endif
+
+#define ONSET_RATIO        3.0f    // block energy vs the previous block's (+4.8 dB)
+#define ONSET_MIN_VOLTS2   1.0e-4f // quieter blocks never count as an attack (~14 mV amplitude)
+
+// set to 0 to analyze every frame; otherwise the first block's energy (measured while it is read) is held
+// against a noise floor that follows the room, and a frame under it costs only that block's capture
+#ifndef TUNER_GATE
+#define TUNER_GATE 1
+#endif
+
+#define GATE_MIN_VOLTS2   4.5e-5f  // always open from here (half the mean square of a tone at PKMAG_MIN); never the floor
+#define GATE_OPEN_RATIO   2.0f     // opens 3 dB over the noise floor ...
+#define GATE_CLOSE_RATIO  1.4f     // ... and closes 1.5 dB over it
+#define GATE_FLOOR_ALPHA  0.05f    // floor follows a quiet room upwards slowly, drops at once
+
+#define USE_BLOCK_ENERGY (TUNER_ONSET || TUNER_GATE)
+
+// set to 0 to start the stream grabber only when a block is asked for; otherwise it is re-armed as soon as a
+// block has been read, so the next one records while the frame is analyzed and the display drawn
+#ifndef TUNER_PIPELINE
+#define TUNER_PIPELINE 1
+#endif
+
+// strum check (float pipeline only): one 512-point frame decimated by 16 with a block average
+// (~3 kHz rate, 6 Hz bins, 168 ms of audio), fine enough to separate the low strings
+#define USE_STRUM       (!TUNER_FIXED_POINT)
+#define STRUM_DECIM     16
+#define STRUM_N         SAMPLES
+#define STRUM_NBINS     (STRUM_N / 2 + 1)
+#define STRUM_MIN_FOUND 3       // fewer strings than this isn't a chord, the last reading stays up
+
+// set to 1 to print FFT and per-block readout time in stream grabber sequence-counter ticks
+#ifndef FFT_PROFILE
+#define FFT_PROFILE 0
+#endif
+
 // Layout constants
 #define SCREEN_W     240
 #define SCREEN_H     320
@@ -37,15 +202,76 @@
 
 
 int int_buffer[SAMPLES];
+#if !TUNER_FIXED_POINT
+// FRAME_N <= SAMPLES; the multi-resolution short frame uses all SAMPLES
 static float q[SAMPLES];
 static float w[SAMPLES];
+#endif
 
 static float dbg_mag[DEBUG_NBINS];
 
-static int32_t raw_int[RAW_SAMPLES];
+#if TUNER_ZOOM && !TUNER_FIXED_POINT
+static float zoom_frame[SAMPLES];      // windowed frame, q is overwritten by the transform
+#endif
+
+#if !TUNER_FIXED_POINT
+static float td_frame[FRAME_N];        // unwindowed frame for the time-domain pitch engines
+static int pitch_ready = 0;
+#endif
+
+static int32_t raw_block[SAMPLES];     // the last block read, undecimated
+static int32_t dec_frame[FRAME_N];     // the frame, decimated as its blocks are read (raw sample units)
+
+#if USE_SDFT
+// sliding DFT tracking: band in bins
+static int sdft_band_lo = 0;
+static int sdft_band_hi = 0;
+#endif
+
+#if USE_SDFT || USE_TRACK
+static int sustain_count = 0;          // how many stable full frames in a row
+#endif
+
+#if USE_TRACK
+static float track_freq = 0.0f;        // latest tracked estimate (before FREQ_CAL), center of the bank
+#endif
 
 static float sample_f = 0.0f;
 
+#if USE_MULTIRES
+static fft_plan* mr_plan = 0;          // undecimated single-block FFT, NULL if it couldn't be created
+#endif
+
+#if USE_STRUM
+static fft_plan* strum_plan = 0;
+static float strum_mag[STRUM_NBINS];
+static const int strum_midi[STRUM_MAX_STRINGS] = { 40, 45, 50, 55, 59, 64 };   // E2 A2 D3 G3 B3 E4
+#endif
+
+#if USE_BLOCK_ENERGY
+static float block_energy = 0.0f;       // mean square of the last block read around block_ref, volts^2
+static int32_t block_ref = 0;           // previous block's mean: a 512-sample block is shorter than a
+static int block_ref_valid = 0;         // low E period, its own mean would take part of the signal
+#endif
+
+#if TUNER_ONSET
+static int onset_pending = 0;           // attack seen since the last Tuner_report
+#endif
+
+#if TUNER_PIPELINE
+static int capture_armed = 0;           // the grabber is recording the next block already
+static int capture_gap = 0;             // the last block read had finished before it was read: the next
+                                        // one doesn't follow it directly
+#endif
+
+#if TUNER_GATE
+static float gate_floor = 0.0f;         // quiet-room block energy, volts^2 (0 until the first block)
+static int gate_open = 0;
+#endif
+
+// 1 if the FFT bin list currently includes the debug spectrum bins
+static int fft_bins_debug = 0;
+
 static int have_note_displayed = 0;
 
 static float freq_display = 0.0f;
@@ -62,9 +288,14 @@ static QState Tuner_initial (Tuner *me);
 static QState Tuner_welcome(Tuner *me);
 static QState Tuner_tuner   (Tuner *me);
 static QState Tuner_tuning(Tuner *me);
+#if USE_TRACK
+static QState Tuner_tracking(Tuner *me);
+#endif
 static QState Tuner_idle    (Tuner *me);
 
-static void Tuner_runOnce(void);    // one complete tuner iteration
+static int  Tuner_runOnce(void);    // one complete tuner iteration, 1 if the note is locked
+static void Tuner_report(float frequency, float peak_mag);
+static void Tuner_setFftBins(int with_debug);
 
 
 // forward declaration for one-time init
@@ -79,7 +310,23 @@ static void Tuner_hwInit(void) {
     // 100 MHz clock / 2048 decimation
     sample_f = CLOCK / 2048.0f;
 
-    fft_init(SAMPLES, M);
+#if !TUNER_FIXED_POINT
+    fft_init(FRAME_N, FRAME_M);
+    fft_plan_set_interp(fft_default_plan(), TUNER_INTERP);
+    pitch_ready = (pitch_init(FRAME_N) == 0);
+#endif
+#if USE_MULTIRES
+    mr_plan = fft_plan_create(SAMPLES);
+    if (mr_plan) fft_plan_set_interp(mr_plan, TUNER_INTERP);
+#endif
+#if USE_STRUM
+    strum_plan = fft_plan_create(STRUM_N);
+    if (strum_plan) fft_plan_set_spectrum(strum_plan, strum_mag, STRUM_NBINS);
+#endif
+    Tuner_setFftBins(0);
+    for (int i = 0; i < TUNER_MODE_MAX; ++i) {
+        Tuner_setEngine((TunerMode)i, HSM_Tuner.engine[i]);
+    }
 
     //xil_printf("Tuner_hwInit: sample_f = %d Hz\r\n", (int)(sample_f + 0.5f));
 }
@@ -96,6 +343,11 @@ void Tuner_ctor(void) {
     HSM_Tuner.freq_hz = 0.0f;
     HSM_Tuner.ref_a4_hz = 440.0f;          // default reference pitch
     HSM_Tuner.debug_page = 0; 	// start with debug page 0 (spectrum)
+    HSM_Tuner.range_lo_hz = TUNER_F_MIN;
+    HSM_Tuner.range_hi_hz = TUNER_F_MAX;
+    for (int i = 0; i < TUNER_MODE_MAX; ++i) {
+        HSM_Tuner.engine[i] = TUNER_ENGINE;
+    }
 }
 
 
@@ -174,6 +426,14 @@ static QState Tuner_tuner(Tuner *me) {
             }
             return Q_HANDLED();
         }
+        case BTN_STRUM_SIG: {
+#if USE_STRUM
+            me->mode = TUNER_MODE_STRUM;
+            tuner_draw_strum_screen(STRUM_MAX_STRINGS);
+            xil_printf("Mode -> STRUM\r\n");
+#endif
+            return Q_HANDLED();
+        }
         case BTN_CAL_SIG: {
             me->mode = TUNER_MODE_CAL;
             tuner_draw_cal_header();
@@ -215,12 +475,43 @@ static QState Tuner_tuning(Tuner *me){
             return Q_HANDLED();
         }
         case TICK_SIG: {
+#if USE_TRACK
+            if (Tuner_runOnce()) {
+                return Q_TRAN(&Tuner_tracking);
+            }
+#else
             Tuner_runOnce();
+#endif
+            return Q_HANDLED();
+        }
+	}
+	return Q_SUPER(&Tuner_tuner);
+}
+
+#if USE_TRACK
+static int Tuner_trackOnce(void);
+
+/* Locked-note state: a Goertzel bank around the note on each new block, full frames again once it's lost */
+static QState Tuner_tracking(Tuner *me){
+	switch(Q_SIG(me)){
+        case Q_ENTRY_SIG: {
+            BSP_display("tracking-ENTRY\n");
+            return Q_HANDLED();
+        }
+        case Q_EXIT_SIG: {
+            gbank_stop();
+            return Q_HANDLED();
+        }
+        case TICK_SIG: {
+            if (!Tuner_trackOnce()) {
+                return Q_TRAN(&Tuner_tuning);
+            }
             return Q_HANDLED();
         }
 	}
 	return Q_SUPER(&Tuner_tuner);
 }
+#endif
 
 /* Idle state that draws main UI and transitions into tuning state */
 static QState Tuner_idle(Tuner *me) {
@@ -246,72 +537,660 @@ static QState Tuner_idle(Tuner *me) {
 }
 
 
+/* Limits the FFT to the bins the peak search (and the debug spectrum, if shown) reads */
+static void Tuner_setFftBins(int with_debug) {
+#if !TUNER_FIXED_POINT
+    // the fixed-point pipeline has no plan (fft_init isn't called): fixed range, every bin, its own magnitudes
+    static int bins[FRAME_N / 2 + 1];    // each bin at most once
+    int count = 0;
+    int first = 0;
+    int i;
+
+    // one extra bin on each side, so a peak at the edge of the range still has both neighbors
+    float bin_hz = sample_f / (float)DECIM_FACTOR / (float)FRAME_N;
+    int lo = (int)(HSM_Tuner.range_lo_hz / bin_hz + 0.5f) - 1;
+    int hi = (int)(HSM_Tuner.range_hi_hz / bin_hz + 0.5f) + 1;
+    if (lo < 1) lo = 1;
+    if (hi > FRAME_N / 2 - 1) hi = FRAME_N / 2 - 1;
+
+    if (with_debug) {
+        for (i = 0; i < DEBUG_NBINS && i <= FRAME_N / 2; ++i) {
+            bins[count++] = i;
+        }
+        first = i;               // the range's bins below this are listed already
+    }
+    if (lo < first) lo = first;
+    for (i = lo; i <= hi && count < FRAME_N / 2 + 1; ++i) {
+        bins[count++] = i;
+    }
+
+    fft_plan_set_range(fft_default_plan(), HSM_Tuner.range_lo_hz, HSM_Tuner.range_hi_hz);
+#if USE_MULTIRES
+    if (mr_plan) fft_plan_set_range(mr_plan, HSM_Tuner.range_lo_hz, HSM_Tuner.range_hi_hz);
+#endif
+    fft_plan_set_bins(fft_default_plan(), bins, count);
+
+    // the transform writes the debug spectrum magnitudes itself
+    fft_plan_set_spectrum(fft_default_plan(), with_debug ? dbg_mag : 0, DEBUG_NBINS);
+#endif
+    fft_bins_debug = with_debug;
+}
+
+
+/* Sets the instrument range searched for the fundamental (e.g. bass only); narrower ranges cost less FFT time */
+void Tuner_setRange(float f_min, float f_max) {
+    HSM_Tuner.range_lo_hz = f_min;
+    HSM_Tuner.range_hi_hz = f_max;
+    Tuner_setFftBins(fft_bins_debug);
+#if USE_SDFT
+    sdft_stop();
+#endif
+#if USE_TRACK
+    gbank_stop();
+#endif
+}
+
+
+/* Selects the pitch engine used in a mode (PITCH_ENGINE_FFT / YIN / MPM), e.g. YIN for an instrument
+   with a weak fundamental; the time-domain engines fall back to the FFT if they aren't available */
+void Tuner_setEngine(TunerMode mode, int engine) {
+    if (mode < 0 || mode >= TUNER_MODE_MAX) return;
+#if TUNER_FIXED_POINT
+    engine = PITCH_ENGINE_FFT;
+#else
+    if (engine != PITCH_ENGINE_YIN && engine != PITCH_ENGINE_MPM) engine = PITCH_ENGINE_FFT;
+    if (!pitch_ready) engine = PITCH_ENGINE_FFT;
+#endif
+    HSM_Tuner.engine[mode] = engine;
+#if USE_SDFT
+    if (engine != PITCH_ENGINE_FFT) sdft_stop();
+#endif
+#if USE_TRACK
+    if (engine != PITCH_ENGINE_FFT) gbank_stop();
+#endif
+}
+
+
 // log2 helper
 static float my_log2f(float x) {
     return logf(x) / 0.69314718f;   // ln(2) ≈ 0.69314718
 }
 
-/* Captures multiple raw sample blocks */
-static void capture_raw_block(int32_t *dst, int total_samples) {
-    int offset = 0;
+#if USE_BLOCK_ENERGY
+/* Energy of one block from its sums around block_ref; with TUNER_ONSET an attack if it jumps ONSET_RATIO
+   over the block before */
+static void Tuner_blockEnergy(int64_t sum, int64_t sum_sq, int n) {
+    float energy = (float)sum_sq / (float)n * SAMPLE_SCALE * SAMPLE_SCALE;
+
+#if TUNER_ONSET
+    if (energy >= ONSET_MIN_VOLTS2 && energy > ONSET_RATIO * block_energy) {
+        onset_pending = 1;
+    }
+#endif
+    block_energy = energy;
+    block_ref += (int32_t)(sum / n);
+}
+#endif
+
+#if TUNER_ONSET
+/* Attack seen since the last call */
+static int Tuner_takeOnset(void) {
+    int seen = onset_pending;
+    onset_pending = 0;
+    return seen;
+}
+#endif
+
+#if TUNER_GATE
+/* Nothing to tune in the last block (gate closed, or no peak past PKMAG_MIN): it is the room's level,
+   unless it is loud enough to be a note (one sounding at boot would otherwise become the floor) */
+static void Tuner_gateIdle(void) {
+    if (block_energy >= GATE_MIN_VOLTS2) return;
+    gate_floor += GATE_FLOOR_ALPHA * (block_energy - gate_floor);
+}
+
+
+/* Level gate on the last block's energy, with hysteresis around the noise floor; returns 1 if open */
+static int Tuner_gateCheck(void) {
+    float e = block_energy;
+
+    if (e < GATE_MIN_VOLTS2 && (gate_floor <= 0.0f || e < gate_floor)) gate_floor = e;
+
+    // over the floor, or past GATE_MIN_VOLTS2 whatever the floor (0 until a quiet block was seen)
+    float open_at = GATE_OPEN_RATIO * gate_floor;
+    float close_at = GATE_CLOSE_RATIO * gate_floor;
+    if (gate_floor <= 0.0f || open_at > GATE_MIN_VOLTS2) open_at = GATE_MIN_VOLTS2;
+    if (gate_floor <= 0.0f || close_at > GATE_MIN_VOLTS2 * (GATE_CLOSE_RATIO / GATE_OPEN_RATIO)) {
+        close_at = GATE_MIN_VOLTS2 * (GATE_CLOSE_RATIO / GATE_OPEN_RATIO);
+    }
+
+    if (gate_open) {
+        if (e < close_at) gate_open = 0;
+    } else if (e >= open_at) {
+        gate_open = 1;
+    }
+
+    if (!gate_open) Tuner_gateIdle();
+    return gate_open;
+}
+
+#endif
+
+/* Captures raw samples have .. total_samples of the frame (the first have are already in), decimating each
+   block into dec_frame as it is read; the frame comes out without gaps between its blocks (see
+   TUNER_PIPELINE), raw_block keeps the last block */
+static void capture_frame(int have, int total_samples) {
+    int offset = have;
+
+#if TUNER_PIPELINE
+    // a gap after the blocks already there (they were analyzed for longer than a block takes): start over
+    if (capture_gap) offset = 0;
+#endif
+
     while (offset < total_samples) {
         int chunk = SAMPLES;  // 512 per capture
-
+        int32_t *dst = raw_block;
+
+#if TUNER_DECIM_FILTER
+        // the filter state only carries over into a block that follows the last one read
+#if TUNER_PIPELINE
+        if (!capture_armed || capture_gap) decim_reset();
+#else
+        decim_reset();
+#endif
+#endif
+
+#if TUNER_PIPELINE
+        if (!capture_armed) {
+            stream_grabber_start();
+        }
+        // already complete: recorded while the CPU was busy, the time since then is missing after it
+        capture_gap = capture_armed && stream_grabber_samples_sampled_captures() >= SAMPLES;
+#else
         stream_grabber_start();
+#endif
         stream_grabber_wait_enough_samples(SAMPLES);
+        stream_grabber_read_block(dst, 0, chunk);
 
+#if TUNER_PIPELINE
+        // re-arm right away: the next block follows this one by the readout time only
+        stream_grabber_start();
+        capture_armed = 1;
+#endif
+
+#if USE_BLOCK_ENERGY
+        // block energy from the copy, while the next block records; for the onset check and the level gate
+        if (!block_ref_valid) {
+            block_ref = dst[0];                             // keeps d small enough for the int64 sums
+            block_ref_valid = 1;
+        }
+        int64_t sum = 0, sum_sq = 0;
         for (int i = 0; i < chunk; ++i) {
-            dst[offset + i] = stream_grabber_read_sample(i);
+            int64_t d = (int64_t)(dst[i] - block_ref);
+            sum += d;
+            sum_sq += d * d;
+        }
+        Tuner_blockEnergy(sum, sum_sq, chunk);
+#endif
+
+        // straight into the decimated frame, the raw frame is never stored
+#if TUNER_DECIM_FILTER
+        decim_block(dst, chunk, dec_frame + offset / DECIM_FACTOR);
+#else
+        for (int i = 0; i < chunk / DECIM_FACTOR; ++i) {
+            dec_frame[offset / DECIM_FACTOR + i] = dst[i * DECIM_FACTOR];
         }
+#endif
 
         offset += chunk;
+#if TUNER_PIPELINE
+        if (capture_gap && offset < total_samples) {
+            // an old block with more to come: it can't be the start of the frame
+            offset = 0;
+        }
+#endif
+    }
+}
+
+#if USE_SDFT || USE_TRACK
+/* 1 if the next block read follows the last one directly; a block-by-block history (sliding DFT,
+   Goertzel bank) can only take it then, a hole in it pulls the estimate off the note */
+static int capture_follows(void) {
+#if TUNER_PIPELINE
+    return capture_armed && !capture_gap;
+#else
+    return 0;           // the grabber only starts when a block is asked for, the time in between is missing
+#endif
+}
+
+
+/* Starts tracking once the full-frame estimate has held still for a few frames; returns 1 if
+   Tuner_tracking takes over (the sliding DFT runs inside Tuner_tuning) */
+static int Tuner_checkSustain(float frequency, float peak_mag) {
+    static float last_freq = 0.0f;
+    int restart = (HSM_Tuner.mode != TUNER_MODE_MAIN || peak_mag < PKMAG_MIN || frequency < 10.0f);
+
+#if TUNER_ONSET
+    // an attack frame: Tuner_report drops it, so it neither counts towards a lock nor starts one
+    if (onset_pending) restart = 1;
+#endif
+    if (restart) {
+        sustain_count = 0;
+        last_freq = 0.0f;
+        return 0;
+    }
+
+    if (last_freq > 0.0f && fabsf(1200.0f * my_log2f(frequency / last_freq)) < SUSTAIN_CENTS) {
+        sustain_count++;
+    } else {
+        sustain_count = 0;
+    }
+    last_freq = frequency;
+
+    if (sustain_count < SUSTAIN_FRAMES) {
+        return 0;
+    }
+    sustain_count = 0;
+
+#if USE_TRACK
+    // the frame just analyzed becomes the bank's history
+    gbank_start(dec_frame, FRAME_N, 1, FRAME_N, SAMPLE_SCALE);
+    track_freq = frequency;
+    return 1;
+#else
+    {
+        float bin_hz = sample_f / (float)DECIM_FACTOR / (float)FRAME_N;
+        int bin = (int)(frequency / bin_hz + 0.5f);
+
+        sdft_band_lo = bin - SDFT_HALF_BAND;
+        sdft_band_hi = bin + SDFT_HALF_BAND;
+        if (sdft_band_lo < 2) sdft_band_lo = 2;
+        if (sdft_band_hi > FRAME_N / 2 - 2) sdft_band_hi = FRAME_N / 2 - 2;
+
+        // the frame just analyzed becomes the sliding window
+        sdft_start(dec_frame, FRAME_N, 1, FRAME_N, SAMPLE_SCALE, sdft_band_lo, sdft_band_hi);
+    }
+    return 0;
+#endif
+}
+#endif
+
+
+#if USE_SDFT
+/* One sliding DFT step: capture a single block, slide it in (a full frame after a gap), estimate from the
+   tracked bins */
+static float Tuner_slideOnce(float sample_f_eff, float* peak_mag) {
+    int peak_bin;
+
+    if (capture_follows()) {
+        capture_frame(0, SAMPLES);
+        sdft_push(dec_frame, SAMPLES / DECIM_FACTOR, 1, SAMPLE_SCALE);
+    } else {
+        // the tick outlasted a block: rebuild the window from a fresh frame on the same band
+        capture_frame(0, RAW_SAMPLES);
+        sdft_start(dec_frame, FRAME_N, 1, FRAME_N, SAMPLE_SCALE, sdft_band_lo, sdft_band_hi);
+    }
+    float frequency = sdft_peak(sample_f_eff, &peak_bin, peak_mag);
+
+    // note gone or moved off the tracked band: full frames again from the next tick
+    if (*peak_mag < PKMAG_MIN || peak_bin <= sdft_band_lo || peak_bin >= sdft_band_hi) {
+        sdft_stop();
+        return frequency;
+    }
+
+#if TUNER_ZOOM
+    sdft_frame(zoom_frame, FRAME_WINDOW);
+    frequency = fft_zoom(zoom_frame, FRAME_WINDOW, FRAME_N, sample_f_eff, frequency,
+                         SDFT_ZOOM_SPAN_BINS * sample_f_eff / (float)FRAME_N, SDFT_ZOOM_POINTS);
+#endif
+    return frequency;
+}
+#endif
+
+
+#if USE_TRACK
+/* One tracking step: capture a single block, slide it in (a full frame after a gap), run the Goertzel bank
+   around the note.
+   Returns 0 once the note is lost (too weak, or moved out of the bank) */
+static int Tuner_trackOnce(void) {
+    float peak_mag;
+    int edge;
+
+    if (!gbank_active() || HSM_Tuner.mode != TUNER_MODE_MAIN ||
+        HSM_Tuner.engine[TUNER_MODE_MAIN] != PITCH_ENGINE_FFT) {
+        return 0;
+    }
+
+    int follows = capture_follows();
+    capture_frame(0, follows ? SAMPLES : RAW_SAMPLES);
+#if TUNER_ONSET
+    if (onset_pending) {
+        // new pluck: full frames again, the attack is taken by the next Tuner_report
+        return 0;
+    }
+#endif
+    if (follows) {
+        gbank_push(dec_frame, SAMPLES / DECIM_FACTOR, 1, SAMPLE_SCALE);
+    } else {
+        // the tick outlasted a block: a fresh frame becomes the history
+        gbank_start(dec_frame, FRAME_N, 1, FRAME_N, SAMPLE_SCALE);
+    }
+    float frequency = gbank_peak(FRAME_WINDOW, sample_f / (float)DECIM_FACTOR, track_freq, TRACK_STEP_CENTS,
+                                 &peak_mag, &edge);
+
+    if (peak_mag < PKMAG_MIN) {
+        // note died away: let the gate decay the display as usual
+        Tuner_report(0.0f, peak_mag);
+        return 0;
+    }
+    if (edge) {
+        // new note (or a big bend), the next full frame finds it
+        return 0;
+    }
+
+    track_freq = frequency;
+    Tuner_report(frequency, peak_mag);
+    return 1;
+}
+#endif
+
+
+#if USE_STRUM
+/* Captures STRUM_N * STRUM_DECIM raw samples, a frame at a time, into q: block averages of the decimated
+   frame down to STRUM_DECIM (a cheap low-pass ahead of the second decimation), DC removed, volts, Hann window */
+static void Tuner_strumCapture(void) {
+    int i, j, k;
+    int per_frame = RAW_SAMPLES / STRUM_DECIM;
+    int avg = STRUM_DECIM / DECIM_FACTOR;
+    float dc = 0.0f;
+
+    for (i = 0; i < STRUM_N; i += per_frame) {
+        capture_frame(0, RAW_SAMPLES);
+        for (j = 0; j < per_frame; j++) {
+            int64_t sum = 0;
+            for (k = 0; k < avg; k++) {
+                sum += dec_frame[j * avg + k];
+            }
+            q[i + j] = (float)sum * (1.0f / (float)avg);
+            dc += q[i + j];
+        }
+    }
+
+    dc *= 1.0f / (float)STRUM_N;
+    for (i = 0; i < STRUM_N; i++) {
+        q[i] = (q[i] - dc) * SAMPLE_SCALE * fft_hann[i];
+    }
+}
+
+
+/* Strum check: one capture, every open string's cents on its own mini bar */
+static void Tuner_strumOnce(void) {
+    float targets[STRUM_MAX_STRINGS];
+    strum_string res[STRUM_MAX_STRINGS];
+    const char* noteName;
+    int octave;
+    int s;
+
+    if (!strum_plan) return;
+
+    float ref = HSM_Tuner.ref_a4_hz;
+    if (ref <= 0.0f) {
+        ref = 440.0f;
+    }
+    for (s = 0; s < STRUM_MAX_STRINGS; s++) {
+        targets[s] = ref * note_ratio_a4[strum_midi[s] - NOTE_MIDI_LO];
     }
+
+    float strum_f = sample_f / (float)STRUM_DECIM;
+    Tuner_strumCapture();
+    fft_execute_real(strum_plan, q, w, strum_f, 0);
+
+    // FREQ_CAL on the bin spacing puts the partials on the targets' scale
+    float bin_hz = strum_f / (float)STRUM_N * FREQ_CAL;
+    int found = strum_analyze(strum_mag, STRUM_NBINS, STRUM_N, bin_hz, targets, STRUM_MAX_STRINGS,
+                              PKMAG_MIN, res);
+    if (found < STRUM_MIN_FOUND) return;
+
+    for (s = 0; s < STRUM_MAX_STRINGS; s++) {
+        int cents = (int)(res[s].cents + (res[s].cents >= 0.0f ? 0.5f : -0.5f));
+        findNoteDetailed(targets[s], ref, &noteName, &octave, 0);
+        tuner_strum_update(s, noteName, octave, cents, res[s].valid);
+        if (res[s].valid) {
+            xil_printf("%s%d %d cents  ", noteName, octave, cents);
+        } else {
+            xil_printf("%s%d --  ", noteName, octave);
+        }
+    }
+    xil_printf("\r\n");
 }
+#endif
+
 
+#if !TUNER_FIXED_POINT
 /* Builts the FFT input frame using DC removal, decimation, scaling, and a Hann window */
 static void build_fft_frame_from_raw(void) {
-    // compute DC offset over RAW_SAMPLES
-    int64_t sum = 0;
-    for (int i = 0; i < RAW_SAMPLES; ++i) {
-        sum += raw_int[i];
-    }
-    // RAW_SAMPLES = 2048 = 2^11, so divide by 2048 via shift
-    int32_t dc = (int32_t)(sum >> 11);   // avg sample
-
-    // decimate + convert to float volts + remove DC
-    const float scale = 3.3f / 67108864.0f;
-
-    for (int i = 0; i < SAMPLES; ++i) {
-        int idx = i * DECIM_FACTOR;      // 0,4,8,... for DECIM_FACTOR=4
-        if (idx >= RAW_SAMPLES) {
-            // safety – shouldn’t happen if RAW_SAMPLES == SAMPLES*DECIM_FACTOR
-            q[i] = 0.0f;
-        } else {
-            int32_t x = raw_int[idx] - dc;
-            q[i] = (float)x * scale;
+    // DC average over the decimated frame, convert to float volts, Hann window
+    // (precomputed table for FRAME_N); SIMD on host builds
+    fft_build_frame(dec_frame, FRAME_N, 1, FRAME_N, SAMPLE_SCALE, FRAME_WINDOW, q);
+}
+
+
+/* YIN / McLeod estimate of the captured frame, refined by the zoom; the FFT only runs for the debug spectrum */
+static float Tuner_pitchOnce(int engine, float sample_f_eff, float* peak_mag) {
+    pitch_result pres;
+
+    fft_build_frame(dec_frame, FRAME_N, 1, FRAME_N, SAMPLE_SCALE, 0, td_frame);
+    float frequency = pitch_estimate(engine, td_frame, FRAME_N, sample_f_eff,
+                                     HSM_Tuner.range_lo_hz, HSM_Tuner.range_hi_hz, &pres);
+
+    // on the FFT's scale for the PKMAG_MIN gate: a tone of power P peaks at |X|^2 = 2P * (FRAME_N/4)^2
+    *peak_mag = 0.0f;
+    if (pres.clarity >= PITCH_CLARITY_MIN) {
+        *peak_mag = 2.0f * pres.power * (0.25f * FRAME_N) * (0.25f * FRAME_N);
+    }
+
+    if (fft_bins_debug) {
+        build_fft_frame_from_raw();
+        fft_execute_real(fft_default_plan(), q, w, sample_f_eff, 0);
+    }
+
+#if TUNER_ZOOM
+    // the lag interpolation is coarse on short periods; the zoom span covers its error
+    if (frequency > 0.0f) {
+        float span = ZOOM_SPAN_BINS * sample_f_eff / (float)FRAME_N;
+        if (PITCH_ZOOM_SPAN * frequency > span) span = PITCH_ZOOM_SPAN * frequency;
+        for (int i = 0; i < FRAME_N; ++i) {
+            zoom_frame[i] = td_frame[i] * FRAME_WINDOW[i];
         }
-        w[i] = 0.0f;   // imag part starts at 0
+        frequency = fft_zoom(zoom_frame, FRAME_WINDOW, FRAME_N, sample_f_eff, frequency, span, ZOOM_POINTS);
+    }
+#endif
+    return frequency;
+}
+#endif
+
+
+#if USE_MULTIRES
+/* Multi-resolution first step: a 512-point FFT of the first raw block alone, undecimated (4x the bin width
+   of the long frame). Returns 1 with the estimate if its peak is above MR_SPLIT_HZ and nothing below the
+   split could be the note's real fundamental; *captured = raw samples already captured either way (the
+   first block is reused if it is there already) */
+static int Tuner_shortOnce(int* captured, float* frequency, float* peak_mag) {
+    fft_result fres;
+    fft_peak_info peaks[MR_PEAKS];
+    int i, count, divisor;
+
+    if (!mr_plan || HSM_Tuner.mode != TUNER_MODE_MAIN ||
+        HSM_Tuner.engine[TUNER_MODE_MAIN] != PITCH_ENGINE_FFT || HSM_Tuner.range_hi_hz < MR_SPLIT_HZ) {
+        return 0;
+    }
+
+    if (!*captured) {
+        capture_frame(0, SAMPLES);
+        *captured = SAMPLES;
     }
 
-    // apply Hann window to q[]
-    for (int i = 0; i < SAMPLES; ++i) {
-        float win = 0.5f - 0.5f * cosf(2.0f * 3.141592f * i / (SAMPLES - 1));
-        q[i] *= win;
+    fft_build_frame(raw_block, SAMPLES, 1, SAMPLES, SAMPLE_SCALE, fft_hann, q);
+#if TUNER_ZOOM
+    memcpy(zoom_frame, q, SAMPLES * sizeof(float));
+#endif
+    float f = fft_execute_real(mr_plan, q, w, sample_f, &fres);
+    if (fres.peak_mag < PKMAG_MIN || f < MR_SPLIT_HZ) return 0;
+
+    // harmonics of a low note: its fundamental, or a subharmonic with odd harmonics, shows below the split
+    fft_plan_harmonic_fix(mr_plan, f, &divisor);
+    if (divisor > 1) return 0;
+    count = fft_plan_get_peaks(mr_plan, peaks, MR_PEAKS);
+    for (i = 0; i < count; i++) {
+        if (peaks[i].frequency < MR_SPLIT_HZ && peaks[i].mag >= MR_LOW_RATIO * fres.peak_mag) return 0;
     }
+
+#if TUNER_ZOOM
+    f = fft_zoom(zoom_frame, fft_hann, SAMPLES, sample_f, f, ZOOM_SPAN_BINS * sample_f / (float)SAMPLES, ZOOM_POINTS);
+#endif
+    *frequency = f;
+    *peak_mag = fres.peak_mag;
+    return 1;
 }
+#endif
 
 
-/* Executes one full tuning cycle: sample capture, FFT/pitch estimate, validation/smoothing, 
-   note/cents mapping, mode dependent UI updates */
-static void Tuner_runOnce(void) {
+/* Executes one full tuning cycle: sample capture, FFT/pitch estimate, then Tuner_report;
+   returns 1 if the note has held still long enough for Tuner_tracking */
+static int Tuner_runOnce(void) {
     float frequency;
-    int   i;
+    int locked = 0;
+
+#if USE_STRUM
+    if (HSM_Tuner.mode == TUNER_MODE_STRUM) {
+#if USE_SDFT
+        sdft_stop();
+#endif
+        Tuner_strumOnce();
+#if TUNER_ONSET
+        Tuner_takeOnset();              // the strum's own attack, not a note to settle on
+#endif
+        return 0;
+    }
+#endif
 
-    // statics for smoothing and UI cycling
-    static float freq_smooth = 0.0f;
-    static int   ui_divider  = 0;        // how many times we've run since last UI update
+    // effective sample rate after decimation
+    float sample_f_eff = sample_f / (float)DECIM_FACTOR;
+
+    // debug spectrum needs the low bins, main mode only the search range
+    int want_debug_bins = (HSM_Tuner.mode == TUNER_MODE_DEBUG);
+    if (want_debug_bins != fft_bins_debug) {
+        Tuner_setFftBins(want_debug_bins);
+    }
+
+    float peak_mag;
+    int captured = 0;                    // raw samples already captured (gate / multi-resolution first block)
+    int silent = 0;
 
-    const float alpha = 0.30f;           // smoothing factor: 0.0 = very slow, 1.0 = no smoothing
+#if USE_SDFT
+    // sustained note in main mode: one block per estimate instead of a full frame
+    if (HSM_Tuner.mode != TUNER_MODE_MAIN) {
+        sdft_stop();
+    }
+#endif
+#if TUNER_GATE
+#if USE_SDFT
+    if (!sdft_active())
+#endif
+    {
+        // the first block's energy decides whether the frame is worth analyzing
+        capture_frame(0, SAMPLES);
+        captured = SAMPLES;
+        silent = !Tuner_gateCheck();
+    }
+#endif
+#if USE_SDFT
+    if (sdft_active()) {
+        frequency = Tuner_slideOnce(sample_f_eff, &peak_mag);
+    } else
+#endif
+    if (silent) {
+        // below the level gate: no frame build, transform or note mapping, the display decays as usual
+        frequency = 0.0f;
+        peak_mag = 0.0f;
+    } else
+#if USE_MULTIRES
+    if (Tuner_shortOnce(&captured, &frequency, &peak_mag)) {
+        // high note settled by the first block, no long frame this time
+    } else
+#endif
+    {
+        //capture one frame from mic via stream grabber (the rest of it after a multi-resolution attempt)
+        capture_frame(captured, RAW_SAMPLES);
+
+#if FFT_PROFILE
+        unsigned fft_t0 = stream_grabber_read_seq_counter();
+#endif
+#if TUNER_FIXED_POINT
+        // integer frame build + FFT straight from the decimated samples
+        frequency = fft_fixed(dec_frame, FRAME_N, 1, FRAME_N, FRAME_M, sample_f_eff);
+        peak_mag = fft_fixed_get_last_peak_mag() * SAMPLE_SCALE * SAMPLE_SCALE;
+#else
+        int engine = HSM_Tuner.engine[HSM_Tuner.mode];
+        if (engine != PITCH_ENGINE_FFT) {
+            frequency = Tuner_pitchOnce(engine, sample_f_eff, &peak_mag);
+        } else {
+            // build FFT frame
+            build_fft_frame_from_raw();
+
+#if TUNER_ZOOM
+            memcpy(zoom_frame, q, FRAME_N * sizeof(float));
+#endif
+
+            // run FFT (real input, w[] is filled by the transform)
+            fft_result fres;
+            frequency = fft_execute_real(fft_default_plan(), q, w, sample_f_eff, &fres);
+            peak_mag = fres.peak_mag;
+
+#if TUNER_ZOOM
+            // refine to sub-cent around the coarse peak instead of running a longer FFT
+            if (frequency > 0.0f) {
+                float bin_hz = sample_f_eff / (float)FRAME_N;
+                frequency = fft_zoom(zoom_frame, FRAME_WINDOW, FRAME_N, sample_f_eff, frequency,
+                                     ZOOM_SPAN_BINS * bin_hz, ZOOM_POINTS);
+            }
+#endif
+
+#if TUNER_OCTAVE_FIX
+            // weak fundamental (bass strings): check the subharmonics on the same spectrum; the
+            // zoom stays on the strong harmonic, a weak fundamental next to it fits worse
+            frequency = fft_plan_harmonic_fix(fft_default_plan(), frequency, 0);
+#endif
+        }
+#endif
+#if FFT_PROFILE
+        xil_printf("fft: %d ticks, readout: %d ticks per block\r\n",
+                   (int)(stream_grabber_read_seq_counter() - fft_t0), (int)stream_grabber_last_readout_ticks());
+#endif
+#if USE_SDFT || USE_TRACK
+        if (HSM_Tuner.engine[HSM_Tuner.mode] == PITCH_ENGINE_FFT) {
+            locked = Tuner_checkSustain(frequency, peak_mag);
+        }
+#endif
+    }
+
+#if TUNER_GATE
+    if (!silent && peak_mag < PKMAG_MIN) {
+        // gate open on noise alone (a louder room than the floor knows): let the floor catch up
+        Tuner_gateIdle();
+    }
+#endif
+
+    Tuner_report(frequency, peak_mag);
+    return locked;
+}
+
+
+/* Validation/smoothing of one estimate (before FREQ_CAL), note/cents mapping, mode dependent UI updates */
+static void Tuner_report(float frequency, float peak_mag) {
+    // statics for UI cycling
+    static int   ui_divider  = 0;        // how many times we've run since last UI update
+    float freq_smooth;                   // tracked frequency (ptrack)
 
     // check to see if LCD needs to be redrawn
     int do_ui = 0;
@@ -324,23 +1203,20 @@ static void Tuner_runOnce(void) {
     // effective sample rate after decimation
     float sample_f_eff = sample_f / (float)DECIM_FACTOR;
 
-    //capture one frame from mic via stream grabber
-    capture_raw_block(raw_int, RAW_SAMPLES);
-
-    // build FFT frame
-    build_fft_frame_from_raw();
+#if TUNER_ONSET
+    if (Tuner_takeOnset()) {
+        // attack frame: broadband, keep it out of the tracker and wait for the new note
+        ptrack_onset();
+        return;
+    }
+#endif
 
-    // run FFT
-    frequency = fft(q, w, SAMPLES, M, sample_f_eff);
-    float peak_mag = fft_get_last_peak_mag();
     frequency *= FREQ_CAL;
 
     // peak magnitude strength gate
     if (peak_mag < PKMAG_MIN) {
-        // decay smoothed frequency toward zero
-        freq_smooth *= 0.9f;
-        if (freq_smooth < 1.0f) freq_smooth = 0.0f;
-        HSM_Tuner.freq_hz = freq_smooth;
+        // the tracker holds the note through a short dropout, then lets go
+        HSM_Tuner.freq_hz = ptrack_miss();
         if (do_ui) {
             if (HSM_Tuner.mode == TUNER_MODE_MAIN) {
                 if(have_note_displayed){
@@ -352,7 +1228,7 @@ static void Tuner_runOnce(void) {
                 }
             } else if (HSM_Tuner.mode == TUNER_MODE_DEBUG) {
             	float sample_f_eff = sample_f / (float)DECIM_FACTOR;
-            	float bin_hz = sample_f_eff / (float)SAMPLES;
+            	float bin_hz = sample_f_eff / (float)FRAME_N;
                 if (HSM_Tuner.debug_page == 0) {
                     // page 0: basic debug text
                     tuner_debug_update(0.0f, "--", 0, 0);
@@ -370,39 +1246,33 @@ static void Tuner_runOnce(void) {
         return;
     }
 
+#if TUNER_FIXED_POINT
     // compute magnitudes for first DEBUG_NBINS bins (for the spectrum plot)
+    int i;
     int mag_bins = DEBUG_NBINS;
-    if (mag_bins > SAMPLES / 2) {
-        mag_bins = SAMPLES / 2;
+    if (mag_bins > FRAME_N / 2) {
+        mag_bins = FRAME_N / 2;
     }
+    fft_fixed_get_mag(dbg_mag, mag_bins);
     for (i = 0; i < mag_bins; ++i) {
-        float re = q[i];
-        float im = w[i];
-        dbg_mag[i] = sqrtf(re * re + im * im);
+        dbg_mag[i] *= SAMPLE_SCALE;
     }
     // if mag_bins < DEBUG_NBINS, zero the rest
     for (i = mag_bins; i < DEBUG_NBINS; ++i) {
         dbg_mag[i] = 0.0f;
     }
+#endif
+    // float pipeline: dbg_mag is filled by the FFT itself in debug mode (fft_plan_set_spectrum)
 
     // basic validity check on raw frequency
     if (frequency < 10.0f) {
-        // too low / no signal – decay the smoothed value toward 0
-        freq_smooth *= 0.9f;
-        if (freq_smooth < 1.0f) {
-            freq_smooth = 0.0f;
-        }
-        HSM_Tuner.freq_hz = freq_smooth;
+        // too low / no signal, same as a weak frame
+        freq_smooth = ptrack_miss();
     } else {
-        // first valid reading, jump straight there
-        if (freq_smooth <= 0.0f) {
-            freq_smooth = frequency;
-        } else {
-            // exponential smoothing
-            freq_smooth = (1.0f - alpha) * freq_smooth + alpha * frequency;
-        }
-        HSM_Tuner.freq_hz = freq_smooth;
+        // confidence: how far the peak clears the noise threshold
+        freq_smooth = ptrack_update(frequency, peak_mag / PKMAG_MIN);
     }
+    HSM_Tuner.freq_hz = freq_smooth;
     // if we still don't have a valid frequency, show "no signal"
     if (freq_smooth < 10.0f) {
     	HSM_Tuner.freq_hz = freq_smooth;
@@ -416,7 +1286,7 @@ static void Tuner_runOnce(void) {
 				}
 			} else if (HSM_Tuner.mode == TUNER_MODE_DEBUG) {
 				float sample_f_eff = sample_f / (float)DECIM_FACTOR;
-				float bin_hz = sample_f_eff / (float)SAMPLES;
+				float bin_hz = sample_f_eff / (float)FRAME_N;
 
 				if (HSM_Tuner.debug_page == 0) {
 					tuner_debug_update(0.0f, "--", 0, 0);
@@ -464,7 +1334,7 @@ static void Tuner_runOnce(void) {
 				} else {
 					// page 1: processing params + peak mag
 					{
-						float bin_hz = sample_f_eff / (float)SAMPLES;
+						float bin_hz = sample_f_eff / (float)FRAME_N;
 						tuner_debug2_update(freq_smooth, cents, sample_f_eff, bin_hz, peak_mag);
 					}
 				}
@@ -472,6 +1342,9 @@ static void Tuner_runOnce(void) {
 			case TUNER_MODE_CAL:
 				// no live UI updates here for now
 				break;
+			case TUNER_MODE_STRUM:
+				// own display (Tuner_strumOnce)
+				break;
 		}
     }
 
@@ -12,6 +12,7 @@ enum TunerSignals {
 	BTN_MAIN_SIG,
 	BTN_DEBUG_SIG,
 	BTN_CAL_SIG,
+	BTN_STRUM_SIG,
 	FFT_READY_SIG,
 	TERMINATE_SIG
 };
@@ -22,6 +23,7 @@ typedef enum {
     TUNER_MODE_MAIN = 0,   // normal chromatic tuner
     TUNER_MODE_DEBUG,      // debug / FFT view 
     TUNER_MODE_CAL,        // calibration / alt tuning 
+    TUNER_MODE_STRUM,      // all six open strings from one strummed chord
     TUNER_MODE_MAX         // sentinel for wrap-around
 } TunerMode;
 
@@ -38,6 +40,9 @@ typedef struct TunerTag {
 	float ref_a4_hz;
 	int debug_page; 	// 0 = spectrum, 1 = debug page 2
 	int welcome_ticks;
+	float range_lo_hz;	// instrument range searched for the fundamental
+	float range_hi_hz;
+	int engine[TUNER_MODE_MAX];	// pitch engine per mode, PITCH_ENGINE_* (pitch.h)
 } Tuner;
 
 
@@ -46,6 +51,8 @@ extern Tuner HSM_Tuner;
 
 // methods
 void Tuner_ctor(void);
+void Tuner_setRange(float f_min, float f_max);
+void Tuner_setEngine(TunerMode mode, int engine);
 void BSP_display(char const *msg);
 void BSP_exit(void);
 
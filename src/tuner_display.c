@@ -73,6 +73,17 @@
 // Number of bins for the spectrum
 #define DEBUG_NBINS 64
 
+// Strum check rows: label, mini cents bar, cents value
+#define STRUM_ROW_Y0    40
+#define STRUM_ROW_H     44
+#define STRUM_LABEL_X   10
+#define STRUM_BAR_X1    40
+#define STRUM_BAR_X2    189
+#define STRUM_BAR_H     20
+#define STRUM_BAR_MID   ((STRUM_BAR_X1 + STRUM_BAR_X2) / 2)
+#define STRUM_CENTS_X   196
+#define STRUM_IN_TUNE   5       // cents; green within this, yellow beyond
+
 static int prev_cents_x = -1;
 
 extern struct _current_font cfont;
@@ -413,6 +424,50 @@ void tuner_draw_debug2_screen(void) {
 
 
 
+/* Draws the top header bar for strum check mode */
+void tuner_draw_strum_header(void) {
+
+    // clear top bar
+	setColor(BLACK);
+	fillRect(0, 0, SCREEN_W - 1, 19);
+
+	// draw text
+	setFont(SmallFont);
+	setColor(MAGENTA);
+	lcdPrint("STRUM CHECK", 5, 4);
+}
+
+/* Draws the strum check screen: one empty mini cents bar per string */
+void tuner_draw_strum_screen(int strings) {
+	// Clear everything below the header bar
+	setColor(BLACK);
+	fillRect(0, 20, SCREEN_W - 1, SCREEN_H - 1);
+
+	tuner_draw_strum_header();
+
+	for (int i = 0; i < strings; ++i) {
+		int y1 = STRUM_ROW_Y0 + i * STRUM_ROW_H;
+		int y2 = y1 + STRUM_BAR_H;
+
+		// outline
+		setColor(80, 80, 80);
+		fillRect(STRUM_BAR_X1, y1, STRUM_BAR_X2, y1 + 1);
+		fillRect(STRUM_BAR_X1, y2, STRUM_BAR_X2, y2 + 1);
+		fillRect(STRUM_BAR_X1, y1, STRUM_BAR_X1 + 1, y2);
+		fillRect(STRUM_BAR_X2, y1, STRUM_BAR_X2 + 1, y2);
+
+		// 0 cents marker
+		setColor(WHITE);
+		fillRect(STRUM_BAR_MID, y1, STRUM_BAR_MID + 1, y2);
+	}
+
+	setFont(SmallFont);
+	setColor(WHITE);
+	lcdPrint("Strum all open strings", 30, SCREEN_H - 20);
+}
+
+
+
 /* ===== Updates the A4 reference value shown on the calibration screen ===== */
 void tuner_update_cal_ref(float a4_hz) {
     char buf[32];
@@ -585,6 +640,61 @@ void tuner_debug_draw_spectrum(const float *mag, int n_bins){
 
 
 
+/* ======================================================*/
+/*                    Strum Check Updates                */
+/* ======================================================*/
+
+/* Redraws one string's row: label, cents marker on its mini bar, cents value ("--" if not found) */
+void tuner_strum_update(int row, const char* noteName, int octave, int cents, int valid){
+	char buf[16];
+	int y1 = STRUM_ROW_Y0 + row * STRUM_ROW_H;
+	int y2 = y1 + STRUM_BAR_H;
+
+	setFont(SmallFont);
+
+	// label
+	setColor(BLACK);
+	fillRect(STRUM_LABEL_X, y1 + 4, STRUM_BAR_X1 - 2, y1 + 4 + DBG_LINE_H);
+	setColor(WHITE);
+	sprintf(buf, "%s%d", noteName, octave);
+	lcdPrint(buf, STRUM_LABEL_X, y1 + 4);
+
+	// bar interior, then the 0 cents marker
+	setColor(BLACK);
+	fillRect(STRUM_BAR_X1 + 2, y1 + 2, STRUM_BAR_X2 - 2, y2 - 2);
+	setColor(WHITE);
+	fillRect(STRUM_BAR_MID, y1, STRUM_BAR_MID + 1, y2);
+
+	// value
+	setColor(BLACK);
+	fillRect(STRUM_CENTS_X, y1 + 4, SCREEN_W - 1, y1 + 4 + DBG_LINE_H);
+
+	if (!valid) {
+		setColor(80, 80, 80);
+		lcdPrint("--", STRUM_CENTS_X, y1 + 4);
+		return;
+	}
+
+	if (cents < -50) cents = -50;
+	if (cents >  50) cents =  50;
+
+	int span_half = (STRUM_BAR_X2 - 2) - STRUM_BAR_MID;
+	int x = STRUM_BAR_MID + (cents * span_half) / 50;
+
+	if (cents >= -STRUM_IN_TUNE && cents <= STRUM_IN_TUNE) {
+		setColor(GREEN);
+	} else {
+		setColor(YELLOW);
+	}
+	fillRect(x - 1, y1 + 2, x + 1, y2 - 2);
+
+	sprintf(buf, "%+d", cents);
+	lcdPrint(buf, STRUM_CENTS_X, y1 + 4);
+}
+
+
+
+
 /* ======================================================*/
 /*                    Private Helpers                    */
 /* ======================================================*/
@@ -15,14 +15,17 @@ void tuner_clear_cents_bar(void);
 void tuner_draw_main_header(void);
 void tuner_draw_debug_header(void);
 void tuner_draw_cal_header(void);
+void tuner_draw_strum_header(void);
 void tuner_draw_cal_screen(float baseAHz);
 void tuner_draw_debug_screen(void);
 void tuner_draw_debug2_screen(void);
+void tuner_draw_strum_screen(int strings);
 
 void tuner_update_cal_ref(float a4_hz);
 void tuner_debug_update(float freq_hz, const char* noteName, int octave, int cents);
 void tuner_debug2_update(float freq_hz, int cents, float fs_eff_hz, float bin_hz, float peak_mag);
 void tuner_debug_draw_spectrum(const float *mag, int n_bins);
+void tuner_strum_update(int row, const char* noteName, int octave, int cents, int valid);
 
 
 
@@ -0,0 +1,117 @@
+/*
+ * batch_bench.c
+ *
+ * Host benchmark of fft_execute_real_batch (fft.c) against one fft_execute_real call per frame.
+ *   - check: 8 frames of Hann-windowed tones, batched and one at a time, full and pruned to the tuner's
+ *     bins; the spectra and peaks must come out bit-identical (exits with 1 otherwise)
+ *   - timing: n = 512, K = 1, 2, 4, 8 frames per call, best of 5 runs, microseconds per frame including
+ *     the copy of the input into q / w that every call needs
+ * The kernel is the build's (-DFFT_KERNEL=FFT_KERNEL_RADIX2 / _RADIX4 / _LEGACY); the plan runs the scalar
+ * code, as on the MicroBlaze, unless a SIMD level is given: ./batch_bench <FFT_SIMD_* level>
+ *
+ *     cc -O2 -Isrc -o batch_bench tools/batch_bench.c src/fft.c src/fft_simd.c src/fft_tables.c src/complex.c -lm
+ *     ./batch_bench
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "fft.h"
+
+#define N        512
+#define K_MAX    8
+#define RUNS     5
+#define FRAMES   200000     // frames transformed per run and K
+
+#define SAMPLE_F (100000000.0f / 2048.0f / 4.0f)
+
+static const double pi = 3.14159265358979323846;
+
+static float x[K_MAX * N];
+static float q[K_MAX * N], w[K_MAX * N];
+static float q1[N], w1[N];
+
+
+static double seconds(void) {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+
+/* Batched vs per-frame on the same frames, peaks and the bins listed (all of 0..n/2 if list is NULL);
+   returns the number of mismatching frames */
+static int check(fft_plan* p, const int* list, int count) {
+	fft_result rb[K_MAX], r1;
+	int f, i, bad = 0;
+
+	memcpy(q, x, sizeof(q));
+	memset(w, 0, sizeof(w));
+	fft_execute_real_batch(p, q, w, K_MAX, SAMPLE_F, rb);
+
+	for (f = 0; f < K_MAX; f++) {
+		memcpy(q1, x + f * N, sizeof(q1));
+		memset(w1, 0, sizeof(w1));
+		fft_execute_real(p, q1, w1, SAMPLE_F, &r1);
+		int same = (r1.frequency == rb[f].frequency && r1.peak_mag == rb[f].peak_mag);
+		for (i = 0; i < (list ? count : N / 2 + 1); i++) {
+			int k = list ? list[i] : i;
+			if (q1[k] != q[f * N + k] || w1[k] != w[f * N + k]) same = 0;
+		}
+		if (!same) bad++;
+	}
+	return bad;
+}
+
+
+int main(int argc, char** argv) {
+	static const int ks[] = { 1, 2, 4, 8 };
+	static int bins[N / 2 + 1];
+	fft_plan* p = fft_plan_create(N);
+	fft_result r[K_MAX];
+	int i, f, t, ki, count = 0;
+
+	if (!p) return 1;
+	int level = fft_plan_set_simd(p, (argc > 1) ? atoi(argv[1]) : FFT_SIMD_SCALAR);
+	fft_plan_set_range(p, 80.0f, 4200.0f);
+
+	// frame f: a tone at (f + 1) * 110 Hz
+	for (f = 0; f < K_MAX; f++) {
+		for (i = 0; i < N; i++) {
+			double h = 0.5 - 0.5 * cos(2.0 * pi * i / (N - 1));
+			x[f * N + i] = (float)(0.5 * h * sin(2.0 * pi * 110.0 * (f + 1) * i / SAMPLE_F));
+		}
+	}
+
+	int bad = check(p, 0, 0);
+	// the tuner's list: the search range plus one bin on each side
+	for (i = 2; i <= 177; i++) bins[count++] = i;
+	fft_plan_set_bins(p, bins, count);
+	bad += check(p, bins, count);
+	printf("batch vs per-frame (full and pruned): %s\n", bad ? "MISMATCH" : "bit-identical");
+	fft_plan_set_bins(p, 0, 0);
+
+	printf("n = %d, kernel %d, SIMD level %d, us per frame (copy-in included)\n", N, FFT_KERNEL, level);
+	for (ki = 0; ki < (int)(sizeof(ks) / sizeof(ks[0])); ki++) {
+		int k = ks[ki];
+		int reps = FRAMES / k;
+		double best = 1e9;
+
+		for (t = 0; t < RUNS; t++) {
+			double t0 = seconds();
+			for (i = 0; i < reps; i++) {
+				memcpy(q, x, k * N * sizeof(float));
+				memset(w, 0, k * N * sizeof(float));
+				fft_execute_real_batch(p, q, w, k, SAMPLE_F, r);
+			}
+			double dt = (seconds() - t0) / ((double)reps * k);
+			if (dt < best) best = dt;
+		}
+		printf("  K = %d: %.3f us\n", k, best * 1e6);
+	}
+
+	fft_plan_destroy(p);
+	return bad ? 1 : 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * fixed_check.c
+ *
+ * Host check of the fixed-point pipeline (fft_fixed.c) against the float one (fft_build_frame +
+ * fft_execute_real on the default plan, same parabolic interpolation) on the tuner's decimated frames.
+ * Tones from E2 to C7, detuned -40 .. +40 cents, on the mic bias with a little ADC noise, at input
+ * amplitudes from near the PKMAG_MIN threshold up to the full ADC swing, so the Q15 input scaling and
+ * the block-floating-point stages see every exponent they meet on the board.
+ * Per amplitude: worst frequency difference in cents and worst relative peak magnitude difference.
+ * Exits with 1 if any frequency is further apart than the tolerance (default 0.5 cents, the figure in
+ * fft_fixed.h): ./fixed_check <cents>
+ *
+ *     cc -O2 -Isrc -o fixed_check tools/fixed_check.c src/fft_fixed.c src/fft.c src/fft_simd.c src/fft_tables.c src/complex.c -lm
+ *     ./fixed_check
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include "fft.h"
+#include "fft_fixed.h"
+#include "fft_tables.h"
+
+#define N         FFT_HANN_N
+#define M         9
+#define SAMPLE_F  (100000000.0 / 2048.0 / 4.0)    // decimated rate
+#define SCALE     (3.3f / 67108864.0f)            // volts per raw sample LSB, as in tuner.c
+#define BIAS      8000000                         // mic bias in raw units
+#define NOISE     1000                            // +- raw LSB of uniform noise
+
+static const double pi = 3.14159265358979323846;
+
+// peak amplitudes in raw units: ~4 mV (just over PKMAG_MIN) up to the ADC's full swing
+static const double amps[] = { 1.0e5, 1.0e6, 1.0e7, 3.0e7 };
+#define AMP_COUNT (int)(sizeof(amps) / sizeof(amps[0]))
+
+static int32_t frame[N];
+static float q[N];
+static float w[N];
+
+
+/* Decimated frame of a tone at f Hz */
+static void make_frame(double f, double amp, double phase) {
+	int i;
+	for (i = 0; i < N; i++) {
+		double x = amp * sin(2.0 * pi * f * i / SAMPLE_F + phase);
+		frame[i] = BIAS + (int32_t)x + (rand() % (2 * NOISE + 1) - NOISE);
+	}
+}
+
+
+int main(int argc, char** argv) {
+	double tol = (argc > 1) ? atof(argv[1]) : 0.5;
+	double worst_all = 0.0;
+	int a, midi, det;
+
+	fft_init(N, M);
+	srand(1);
+
+	printf("fixed-point vs float pipeline, n = %d at %.1f Hz, E2..C7 +-40 cents\n", N, SAMPLE_F);
+	printf("%12s %10s %14s %14s\n", "amp (volts)", "frames", "worst cents", "worst peak");
+
+	for (a = 0; a < AMP_COUNT; a++) {
+		double worst = 0.0, worst_pk = 0.0;
+		int frames = 0;
+
+		for (midi = 40; midi <= 96; midi++) {
+			for (det = -40; det <= 40; det += 20) {
+				double f = 440.0 * pow(2.0, (midi - 69 + det / 100.0) / 12.0);
+				fft_result fres;
+
+				make_frame(f, amps[a], 0.7 + 0.1 * midi);
+
+				fft_build_frame(frame, N, 1, N, SCALE, fft_hann, q);
+				float ff = fft_execute_real(fft_default_plan(), q, w, (float)SAMPLE_F, &fres);
+
+				float fx = fft_fixed(frame, N, 1, N, M, (float)SAMPLE_F);
+				float px = fft_fixed_get_last_peak_mag() * SCALE * SCALE;
+
+				double c = (ff > 0.0f && fx > 0.0f) ? fabs(1200.0 * log2(fx / ff)) : 1200.0;
+				double pk = fabs(px / fres.peak_mag - 1.0);
+				if (c > worst) worst = c;
+				if (pk > worst_pk) worst_pk = pk;
+				frames++;
+			}
+		}
+		printf("%12.4f %10d %14.4f %14.4g\n", amps[a] * SCALE, frames, worst, worst_pk);
+		if (worst > worst_all) worst_all = worst;
+	}
+
+	printf("worst %.4f cents, tolerance %.2f: %s\n", worst_all, tol, worst_all <= tol ? "pass" : "FAIL");
+	return worst_all <= tol ? 0 : 1;
+}
@@ -0,0 +1,102 @@
+/*
+ * gen_tables.c
+ *
+ * Host tool that generates src/fft_tables.c: the FFT twiddle factors (float and Q15),
+ * the Hann windows (float and Q15, plus a float half-length one) and the equal-temperament note ratios used on the board.
+ * Everything is computed in double precision and emitted as const data, so the
+ * MicroBlaze does no trig work at boot or per frame.
+ *
+ * Regenerate after changing the sizes below (and FFT_TABLE_* in fft_tables.h):
+ *     cc -O2 -o gen_tables tools/gen_tables.c -lm
+ *     ./gen_tables > src/fft_tables.c
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+
+#define TABLE_M     9               // stages covered by the twiddle table (N = 512)
+#define TABLE_N     (1 << TABLE_M)
+#define WINDOW_N    512             // FFT frame length
+#define WINDOW_SHORT_N 256          // half-length frame (TUNER_FRAME_BLOCKS = 2)
+#define MIDI_LO     21              // A0
+#define MIDI_HI     108             // C8
+
+static const double pi = 3.14159265358979323846;
+
+
+static int to_q15(double x) {
+	return (int)lround(x * 32767.0);
+}
+
+
+static void print_float_table(const char* name, const double* v, int count) {
+	int i;
+	char buf[32];
+	printf("const float %s[%d] = {", name, count);
+	for (i = 0; i < count; i++) {
+		// exact zeros instead of cos(PI/2) rounding noise, always a valid float literal
+		double x = (fabs(v[i]) < 1e-12) ? 0.0 : v[i];
+		snprintf(buf, sizeof buf, "%.9g", x);
+		if (!strpbrk(buf, ".e")) strcat(buf, ".0");
+		printf("%s%sf,", (i % 6) ? " " : "\n\t", buf);
+	}
+	printf("\n};\n\n");
+}
+
+
+static void print_q15_table(const char* name, const double* v, int count) {
+	int i;
+	printf("const int16_t %s[%d] = {", name, count);
+	for (i = 0; i < count; i++) {
+		printf("%s%6d,", (i % 10) ? " " : "\n\t", to_q15(v[i]));
+	}
+	printf("\n};\n\n");
+}
+
+
+int main(void) {
+	static double tw_re[TABLE_N - 1];
+	static double tw_im[TABLE_N - 1];
+	static double hann[WINDOW_N];
+	static double hann_short[WINDOW_SHORT_N];
+	static double ratio[MIDI_HI - MIDI_LO + 1];
+	int j, k, i;
+
+	// stage j twiddles exp(-j*PI*k/2^j), k < 2^j, stored back to back from index 2^j - 1
+	for (j = 0; j < TABLE_M; j++) {
+		int b = 1 << j;
+		for (k = 0; k < b; k++) {
+			tw_re[b - 1 + k] = cos(-pi * k / b);
+			tw_im[b - 1 + k] = sin(-pi * k / b);
+		}
+	}
+
+	// symmetric Hann window over the frame
+	for (i = 0; i < WINDOW_N; i++) {
+		hann[i] = 0.5 - 0.5 * cos(2.0 * pi * i / (WINDOW_N - 1));
+	}
+	for (i = 0; i < WINDOW_SHORT_N; i++) {
+		hann_short[i] = 0.5 - 0.5 * cos(2.0 * pi * i / (WINDOW_SHORT_N - 1));
+	}
+
+	// note frequency / A4 frequency for each MIDI note
+	for (i = MIDI_LO; i <= MIDI_HI; i++) {
+		ratio[i - MIDI_LO] = pow(2.0, (i - 69) / 12.0);
+	}
+
+	printf("/* Generated by tools/gen_tables.c, do not edit. */\n\n");
+	printf("#include <stdint.h>\n");
+	printf("#include \"fft_tables.h\"\n\n");
+
+	print_float_table("fft_twiddle_re", tw_re, TABLE_N - 1);
+	print_float_table("fft_twiddle_im", tw_im, TABLE_N - 1);
+	print_q15_table("fft_twiddle_re_q15", tw_re, TABLE_N - 1);
+	print_q15_table("fft_twiddle_im_q15", tw_im, TABLE_N - 1);
+	print_float_table("fft_hann", hann, WINDOW_N);
+	print_q15_table("fft_hann_q15", hann, WINDOW_N);
+	print_float_table("fft_hann_short", hann_short, WINDOW_SHORT_N);
+	print_float_table("note_ratio_a4", ratio, MIDI_HI - MIDI_LO + 1);
+
+	return 0;
+}
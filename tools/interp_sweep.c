@@ -0,0 +1,156 @@
+/*
+ * interp_sweep.c
+ *
+ * Host tool that measures the peak interpolators of fft.c (FFT_INTERP_*) on synthetic tones.
+ * Two sweeps per frame length (256 and 512):
+ *   - offset sweep: a tone at n/8 + d bins, d = -0.5 .. 0.5, error in bins per interpolator
+ *     (the bias curve, worst case over a few phases)
+ *   - note sweep: E2 .. C7 at the tuner's decimated rate (100 MHz / 2048 / 4), Hann window
+ *     from the generated table's formula, error in cents per interpolator (worst case over phases)
+ * Optional noise: ./interp_sweep <snr_db> adds white noise at that SNR to every frame.
+ *
+ *     cc -O2 -Isrc -o interp_sweep tools/interp_sweep.c src/fft.c src/fft_simd.c src/fft_tables.c src/complex.c -lm
+ *     ./interp_sweep
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "fft.h"
+
+#define SAMPLE_F  (100000000.0 / 2048.0 / 4.0)
+#define PHASES    8
+#define MAX_N     512
+
+static const double pi = 3.14159265358979323846;
+
+static const char* interp_name[] = { "parabolic", "gaussian", "jain", "quinn" };
+#define INTERP_COUNT 4
+
+static double noise_amp = 0.0;
+
+
+/* Uniform (0, 1) */
+static double uniform(void) {
+	return (rand() + 1.0) / (RAND_MAX + 2.0);
+}
+
+
+/* Gaussian, Box-Muller */
+static double gauss(void) {
+	return sqrt(-2.0 * log(uniform())) * cos(2.0 * pi * uniform());
+}
+
+
+/* Hann-windowed tone (cycles per sample f), plus noise, into q */
+static void make_frame(float* q, int n, double f, double phase) {
+	int i;
+	for (i = 0; i < n; i++) {
+		double h = 0.5 - 0.5 * cos(2.0 * pi * i / (n - 1));
+		double x = cos(2.0 * pi * f * i + phase);
+		if (noise_amp > 0.0) x += noise_amp * gauss();
+		q[i] = (float)(h * x);
+	}
+}
+
+
+/* Frequency estimate of one frame with the given interpolator */
+static double estimate(fft_plan* p, int interp, int n, double f, double phase, double sample_f) {
+	static float q[MAX_N];
+	static float w[MAX_N];
+
+	make_frame(q, n, f / sample_f, phase);
+	fft_plan_set_interp(p, interp);
+	return fft_execute_real(p, q, w, (float)sample_f, 0);
+}
+
+
+static void offset_sweep(int n) {
+	fft_plan* p = fft_plan_create(n);
+	double worst[INTERP_COUNT] = { 0 };
+	int s, k, ph;
+
+	fft_plan_set_range(p, 1.0f, (float)(n / 2 - 1));
+	printf("n = %d, tone at %d + d bins: error in bins (worst over %d phases)\n", n, n / 8, PHASES);
+	printf("%7s", "d");
+	for (k = 0; k < INTERP_COUNT; k++) printf(" %10s", interp_name[k]);
+	printf("\n");
+
+	for (s = -10; s <= 10; s++) {
+		double d = s * 0.05;
+		printf("%7.2f", d);
+		for (k = 0; k < INTERP_COUNT; k++) {
+			double err = 0.0;
+			for (ph = 0; ph < PHASES; ph++) {
+				double bins = n / 8 + d;
+				// sample_f = n, so the estimate comes back in bins
+				double e = estimate(p, k, n, bins, 2.0 * pi * ph / PHASES, (double)n) - bins;
+				if (fabs(e) > fabs(err)) err = e;
+			}
+			if (fabs(err) > worst[k]) worst[k] = fabs(err);
+			printf(" %10.5f", err);
+		}
+		printf("\n");
+	}
+	printf("%7s", "max");
+	for (k = 0; k < INTERP_COUNT; k++) printf(" %10.5f", worst[k]);
+	printf("\n\n");
+
+	fft_plan_destroy(p);
+}
+
+
+static void note_sweep(int n) {
+	fft_plan* p = fft_plan_create(n);
+	double worst[INTERP_COUNT] = { 0 };
+	double worst_a2[INTERP_COUNT] = { 0 };
+	int midi, k, ph;
+
+	fft_plan_set_range(p, 80.0f, 4200.0f);
+	printf("n = %d, notes at %.1f Hz (%.1f Hz bins): |error| in cents (worst over %d phases)\n",
+	       n, SAMPLE_F, SAMPLE_F / n, PHASES);
+	printf("%5s %8s", "midi", "Hz");
+	for (k = 0; k < INTERP_COUNT; k++) printf(" %10s", interp_name[k]);
+	printf("\n");
+
+	for (midi = 40; midi <= 108; midi++) {      // E2 .. C8, stops at the search range
+		double f = 440.0 * pow(2.0, (midi - 69) / 12.0);
+		if (f > 4186.0) break;
+		int row = (midi < 52) || (midi % 6 == 0);
+		if (row) printf("%5d %8.2f", midi, f);
+		for (k = 0; k < INTERP_COUNT; k++) {
+			double err = 0.0;
+			for (ph = 0; ph < PHASES; ph++) {
+				double est = estimate(p, k, n, f, 2.0 * pi * ph / PHASES, SAMPLE_F);
+				double c = (est > 0.0) ? fabs(1200.0 * log2(est / f)) : 1200.0;
+				if (c > err) err = c;
+			}
+			if (err > worst[k]) worst[k] = err;
+			if (midi >= 45 && err > worst_a2[k]) worst_a2[k] = err;
+			if (row) printf(" %10.3f", err);
+		}
+		if (row) printf("\n");
+	}
+	printf("%14s", "max E2..C7");
+	for (k = 0; k < INTERP_COUNT; k++) printf(" %10.3f", worst[k]);
+	printf("\n%14s", "max A2..C7");
+	for (k = 0; k < INTERP_COUNT; k++) printf(" %10.3f", worst_a2[k]);
+	printf("\n\n");
+
+	fft_plan_destroy(p);
+}
+
+
+int main(int argc, char** argv) {
+	if (argc > 1) {
+		// tone amplitude 1 -> power 0.5
+		noise_amp = sqrt(0.5 / pow(10.0, atof(argv[1]) / 10.0));
+		printf("white noise at %s dB SNR\n\n", argv[1]);
+	}
+
+	offset_sweep(256);
+	offset_sweep(512);
+	note_sweep(256);
+	note_sweep(512);
+	return 0;
+}